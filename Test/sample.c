@@ -0,0 +1,197 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "cbo.h"
+
+// Number of files in the sampled directory
+#define SAMPLE_NB_FILE 32
+
+// Number of seeds compared
+#define SAMPLE_NB_SEED 16
+
+// Maximum length of the path of a file
+#define SAMPLE_LENGTH_PATH 64
+
+// Get the sample of the files 'paths' selected by a CBo with the seed
+// 'seed' and a sample of 50%
+// Return the mask of the sampled files (1 << index of the file), or 0
+// if the arguments were not correct
+uint64_t SampleGetMask(
+  const char** const paths,
+  const unsigned int seed) {
+
+  // Create the arguments of the CBo: the name of the command, the
+  // sampling options and the files
+  char strSeed[16];
+  sprintf(
+    strSeed,
+    "%u",
+    seed);
+  const char* argv[SAMPLE_NB_FILE + 5];
+  argv[0] = "cbo";
+  argv[1] = "--sample";
+  argv[2] = "50";
+  argv[3] = "--seed";
+  argv[4] = strSeed;
+  for (
+    int iFile = 0;
+    iFile < SAMPLE_NB_FILE;
+    ++iFile) {
+
+    argv[5 + iFile] = paths[iFile];
+
+  }
+
+  // Create an instance of CBo and process the arguments, which select
+  // the sampled files
+  CBo* cbo = CBoCreate();
+  bool isValid =
+    CBoProcessCmdLineArguments(
+      cbo,
+      SAMPLE_NB_FILE + 5,
+      argv);
+
+  // Get the mask of the sampled files, they are the paths of the
+  // arguments
+  uint64_t mask = 0;
+  if (
+    isValid == true &&
+    GSetNbElem(&(cbo->filePaths)) > 0) {
+
+    GSetIterForward iter = GSetIterForwardCreateStatic(&(cbo->filePaths));
+    do {
+
+      const char* path = GSetIterGet(&iter);
+      for (
+        int iFile = 0;
+        iFile < SAMPLE_NB_FILE;
+        ++iFile) {
+
+        if (path == paths[iFile]) {
+
+          mask |= (uint64_t)1 << iFile;
+
+        }
+
+      }
+
+    } while (GSetIterStep(&iter));
+
+  }
+
+  // Free the instance of CBo
+  CBoFree(&cbo);
+
+  // Return the mask
+  return mask;
+
+}
+
+// Sample the files of a temporary directory with several seeds, each
+// seed must select a different sample, even the close ones
+int main(void) {
+
+  // Declare a variable to memorize the returned code
+  int retCode = 0;
+
+  // Create the files in a temporary directory
+  char dir[] = "/tmp/cboSampleXXXXXX";
+  if (mkdtemp(dir) == NULL) {
+
+    fprintf(
+      stderr,
+      "Failed to create the temporary directory\n");
+    exit(EXIT_FAILURE);
+
+  }
+
+  char paths[SAMPLE_NB_FILE][SAMPLE_LENGTH_PATH];
+  const char* ptrPaths[SAMPLE_NB_FILE];
+  for (
+    int iFile = 0;
+    iFile < SAMPLE_NB_FILE;
+    ++iFile) {
+
+    sprintf(
+      paths[iFile],
+      "%s/f%02d.c",
+      dir,
+      iFile);
+    ptrPaths[iFile] = paths[iFile];
+    FILE* f =
+      fopen(
+        paths[iFile],
+        "w");
+    if (f == NULL) {
+
+      fprintf(
+        stderr,
+        "Failed to create the file [%s]\n",
+        paths[iFile]);
+      exit(EXIT_FAILURE);
+
+    }
+
+    fclose(f);
+
+  }
+
+  // Get the sample of each seed, and check it differs from the samples
+  // of the previous seeds
+  uint64_t masks[SAMPLE_NB_SEED];
+  for (
+    unsigned int iSeed = 0;
+    iSeed < SAMPLE_NB_SEED;
+    ++iSeed) {
+
+    masks[iSeed] =
+      SampleGetMask(
+        ptrPaths,
+        iSeed);
+    if (masks[iSeed] == 0) {
+
+      fprintf(
+        stderr,
+        "No file was sampled with the seed %u\n",
+        iSeed);
+      retCode = 1;
+
+    }
+
+    for (
+      unsigned int jSeed = 0;
+      jSeed < iSeed;
+      ++jSeed) {
+
+      if (masks[iSeed] == masks[jSeed]) {
+
+        fprintf(
+          stderr,
+          "The seeds %u and %u selected the same sample\n",
+          jSeed,
+          iSeed);
+        retCode = 1;
+
+      }
+
+    }
+
+  }
+
+  // Remove the files and the temporary directory
+  for (
+    int iFile = 0;
+    iFile < SAMPLE_NB_FILE;
+    ++iFile) {
+
+    remove(paths[iFile]);
+
+  }
+
+  rmdir(dir);
+
+  // Return the code
+  return retCode;
+
+}
@@ -0,0 +1,17 @@
+// Binary operators missing their spaces, each line must be reported
+int a = (a + b)*2;
+int b = f(x)-1;
+if (a*b > 0) return 1;
+foo(a*b);
+
+// Unary operators, casts and pointers, no line must be reported
+int c = (int)-1;
+CBoLine** lines = (CBoLine**)malloc(sizeof(CBoLine*) * 2);
+const char* const str = NULL;
+struct X* p = NULL;
+unsigned int* q = &a;
+int d = -a + *p;
+size_t e = sizeof(int) * 2;
+void bar(CBo* cbo);
+uint64_t w = (uint64_t)1 << a;
+return (int)*p;
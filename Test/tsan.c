@@ -0,0 +1,178 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "cbo.h"
+
+// Number of CBo checking the files concurrently
+#define TSAN_NB_CBO 4
+
+// Maximum number of options of the CBo of a thread
+#define TSAN_NB_MAX_OPTION 4
+
+// Options of the CBo of each thread, each one checks the files in its
+// own way so the pipeline, the parallel rules and the records run
+// concurrently
+const char* const tsanOptions[TSAN_NB_CBO][TSAN_NB_MAX_OPTION] = {
+
+  {"-j", "1", NULL, NULL},
+  {"-j", "4", NULL, NULL},
+  {"-j", "2", "--parallel-rules", "1"},
+  {"-j", "3", "--format=jsonl", NULL},
+
+};
+
+// Structure to memorize the arguments and the result of one thread
+typedef struct TsanThread {
+
+  // Arguments of the command line of the CBo of the thread
+  int argc;
+  const char** argv;
+
+  // Flag to memorize if the arguments were correct
+  bool isValid;
+
+  // Number of errors found by the CBo of the thread
+  unsigned int nbError;
+
+} TsanThread;
+
+// Main function of the threads: check the files with the CBo of the
+// TsanThread 'arg'
+// Return NULL
+void* TsanCheck(void* arg) {
+
+  // Get the thread
+  TsanThread* thread = (TsanThread*)arg;
+
+  // Create an instance of CBo for this thread
+  CBo* cbo = CBoCreate();
+
+  // Process the arguments of the thread
+  thread->isValid =
+    CBoProcessCmdLineArguments(
+      cbo,
+      thread->argc,
+      thread->argv);
+
+  // If we could process the arguments, check all the files
+  if (thread->isValid == true) {
+
+    CBoCheckAllFiles(cbo);
+    thread->nbError = CBoGetNbErrors(cbo);
+
+  }
+
+  // Free the instance of CBo
+  CBoFree(&cbo);
+
+  // Return NULL
+  return NULL;
+
+}
+
+// Check the files given in argument with several CBo in parallel
+// threads, each CBo using its own threads too, to be run under the
+// ThreadSanitizer which reports the data races. All the CBo must find
+// the same number of errors
+int main(
+                 int argc,
+  const char** const argv) {
+
+  // Declare a variable to memorize the returned code
+  int retCode = 0;
+
+  // Create the arguments of the threads: the name of the command, the
+  // options of the thread and the files
+  TsanThread threads[TSAN_NB_CBO];
+  for (
+    int iThread = 0;
+    iThread < TSAN_NB_CBO;
+    ++iThread) {
+
+    TsanThread* thread = threads + iThread;
+    thread->argv = malloc(sizeof(char*) * (argc + TSAN_NB_MAX_OPTION));
+    thread->argv[0] = argv[0];
+    thread->argc = 1;
+    for (
+      int iOption = 0;
+      iOption < TSAN_NB_MAX_OPTION &&
+      tsanOptions[iThread][iOption] != NULL;
+      ++iOption) {
+
+      thread->argv[thread->argc] = tsanOptions[iThread][iOption];
+      ++(thread->argc);
+
+    }
+
+    for (
+      int iArg = 1;
+      iArg < argc;
+      ++iArg) {
+
+      thread->argv[thread->argc] = argv[iArg];
+      ++(thread->argc);
+
+    }
+
+    thread->isValid = false;
+    thread->nbError = 0;
+
+  }
+
+  // Start the threads
+  pthread_t ids[TSAN_NB_CBO];
+  for (
+    int iThread = 0;
+    iThread < TSAN_NB_CBO;
+    ++iThread) {
+
+    int ret =
+      pthread_create(
+        ids + iThread,
+        NULL,
+        TsanCheck,
+        threads + iThread);
+    if (ret != 0) {
+
+      fprintf(
+        stderr,
+        "Failed to start the thread %d\n",
+        iThread);
+      exit(EXIT_FAILURE);
+
+    }
+
+  }
+
+  // Wait for the threads to end, and check they all found the same
+  // number of errors as the first one
+  for (
+    int iThread = 0;
+    iThread < TSAN_NB_CBO;
+    ++iThread) {
+
+    pthread_join(
+      ids[iThread],
+      NULL);
+    if (
+      threads[iThread].isValid == false ||
+      threads[iThread].nbError != threads[0].nbError) {
+
+      fprintf(
+        stderr,
+        "The CBo of the thread %d found %u error(s) instead of %u\n",
+        iThread,
+        threads[iThread].nbError,
+        threads[0].nbError);
+      retCode = 1;
+
+    }
+
+    free(threads[iThread].argv);
+
+  }
+
+  // Return success code
+  return retCode;
+
+}
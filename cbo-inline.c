@@ -21,6 +21,16 @@ int CBoGetNbFiles(const CBo* const that) {
 
 #endif
 
+  // If the paths are partial or binary results, return the number of
+  // files they contain
+  if (
+    that->flagMerge == true ||
+    that->flagReport == true) {
+
+    return (int)(that->nbMergedFile);
+
+  }
+
   return GSetNbElem(&(that->filePaths));
 
 }
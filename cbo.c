@@ -14,6 +14,104 @@
 // Size of one indent level
 #define CBOLINE_INDENT_SIZE 2
 
+// Number of lines per word in the bitsets of lines
+#define CBOFILE_NB_LINE_PER_WORD 64
+
+// Minimum number of lines per chunk when the indentation levels of a
+// file are calculated in parallel
+#define CBOFILE_INDENT_CHUNK_MIN_NB_LINE 16384
+
+// Number of lines between two checkpoints of the state of the
+// calculation of the indentation levels, from which the check of a
+// range of lines resumes the calculation
+#define CBOFILE_INDENT_NB_LINE_CHECKPOINT 256
+
+// Maximum number of files per batch sent to a worker process, and
+// number of batches per worker the remaining files are split into, so
+// the batches get smaller toward the end of the check
+#define CBO_BATCH_MAX_NB_FILE 16
+#define CBO_BATCH_NB_PER_WORKER 4
+
+// Delay in milliseconds between two checks of the end of the check by
+// the coordinator waiting for worker processes
+#define CBO_COORDINATOR_POLL_MS 100
+
+// Number of attempts, one every CBO_COORDINATOR_POLL_MS, of a worker
+// process to connect to the coordinator
+#define CBO_WORKER_NB_CONNECT_TRY 50
+
+// Quantile of the normal distribution for the 95% confidence intervals
+// of the estimations from a sample
+#define CBO_SAMPLE_Z95 1.96
+
+// Size in bytes of the ring through which the child processes checking
+// the files in isolation send their result
+#define CBO_ISOLATE_RING_SIZE 65536
+
+// Delay in milliseconds between two checks of the end of the process
+// at the other end of the ring, while waiting on it
+#define CBO_ISOLATE_POLL_MS 100
+
+// Default time budget in milliseconds of the check of a file in
+// isolation, used when no timeout is given so a child process blocked
+// on a lock held by another thread at the time of the fork can't block
+// its parent forever
+#define CBO_ISOLATE_TIMEOUT_MS 60000
+
+// Minimum delay in milliseconds between two displays of the progress,
+// and width of the line of the progress
+#define CBO_PROGRESS_DELAY_MS 100
+#define CBO_PROGRESS_WIDTH 79
+
+// Magic number at the head and the tail of the binary output, and
+// version of the binary output
+#define CBO_BINARY_MAGIC "CBoBin1"
+#define CBO_BINARY_VERSION 1
+
+// Rules of the records of the problems concerning a whole file,
+// numbered after the error types, and number of rules of the records
+#define CBO_RULE_LOAD_FAILED CBoErrorType_nb
+#define CBO_RULE_CHECK_ABORTED (CBoErrorType_nb + 1)
+#define CBO_NB_RULE (CBoErrorType_nb + 2)
+
+// Version of the baseline file, and initial number of slots (power of
+// 2) of the hash set of the baseline
+#define CBO_BASELINE_VERSION 1
+#define CBO_BASELINE_MIN_NB_SLOT 1024
+
+// Maximum number of passes of fixes on a file, a fix can reveal other
+// fixable errors, and number of segments written at once in the fixed
+// file
+#define CBO_FIX_NB_MAX_PASS 4
+#define CBO_FIX_NB_SEGMENT 512
+
+// Completed progress bar displayed with the result of a rule
+#define CBO_RULE_RESULT_PROGBAR "[##########]"
+
+// Number of lines of context around the changes in the diff of fixes
+#define CBO_DIFF_NB_CONTEXT 3
+
+// Parameters of the 64 bits FNV-1a hash
+#define CBO_FNV1A_OFFSET 0xcbf29ce484222325ULL
+#define CBO_FNV1A_PRIME 0x100000001b3ULL
+
+// Seed of the 32 bits djb2 hash
+#define CBO_DJB2_SEED 5381u
+
+// Multipliers of the finalizer of the splitmix64 generator
+#define CBO_MIX64_MUL1 0xbf58476d1ce4e5b9ULL
+#define CBO_MIX64_MUL2 0x94d049bb133111ebULL
+
+// Number of entries (power of 2) and maximum number of probes of the
+// memoization table of the line local rules
+#define CBO_LINE_MEMO_SIZE 65536
+#define CBO_LINE_MEMO_NB_PROBE 8
+
+// Flag and mask of the values in the memoization table of the line
+// local rules
+#define CBO_LINE_MEMO_READY ((uint64_t)1 << 31)
+#define CBO_LINE_MEMO_MASK ((uint64_t)0x7FFFFFFF)
+
 // ================= Data structures ===================
 
 // Structure to memorize one line of a file
@@ -25,6 +123,13 @@ typedef struct CBoLine {
   // Correct indent level
   unsigned int indent;
 
+  // Mask (1 << CBoRuleId) of the line local rules broken by the line
+  unsigned int localErrors;
+
+  // Index plus one of the line in the file as loaded, 0 if the line was
+  // inserted by a fix, used to get the diff of the fixes
+  unsigned int iLineOrig;
+
 } CBoLine;
 
 // Enum for the file type
@@ -36,6 +141,55 @@ typedef enum CBoFileType {
 
 } CBoFileType;
 
+// Enum for the properties of lines memorized in the bitsets of lines
+typedef enum CBoLineFlag {
+
+  // Empty line
+  CBoLineFlag_blank,
+
+  // Line starting with a comment
+  CBoLineFlag_comment,
+
+  // Line ending with an opening curly brace
+  CBoLineFlag_openCurlyAtTail,
+
+  // Line ending with a closing curly brace
+  CBoLineFlag_closeCurlyAtTail,
+
+  // Line starting with a closing curly brace
+  CBoLineFlag_closeCurlyAtHead,
+
+  // Line starting with 'case ' or 'default:'
+  CBoLineFlag_caseLabel,
+
+  // Line ending with a continuation mark
+  CBoLineFlag_continuation,
+
+  // Line belonging to a precompiler command
+  CBoLineFlag_precompilCmd,
+
+  // Number of properties
+  CBoLineFlag_nb
+
+} CBoLineFlag;
+
+// Enum for the kinds of the comments suppressing the check of rules
+typedef enum CBoSuppressKind {
+
+  // The line is not a suppression comment
+  CBoSuppressKind_none,
+
+  // 'cbo-off', the rules are suppressed until the next 'cbo-on'
+  CBoSuppressKind_off,
+
+  // 'cbo-on', end of the suppression of the rules
+  CBoSuppressKind_on,
+
+  // 'cbo-off-next-line', the rules are suppressed on the next line only
+  CBoSuppressKind_offNextLine
+
+} CBoSuppressKind;
+
 // Structure to memorize the info about one file
 typedef struct CBoFile {
 
@@ -51,8 +205,171 @@ typedef struct CBoFile {
   // Set of CBoError
   GSet errors;
 
+  // Array of pointers to the lines, for direct access by index
+  CBoLine** lineArr;
+
+  // Number of words in each bitset of lines
+  unsigned int nbWord;
+
+  // Bitsets of the properties of the lines, one bit per line, the
+  // line 'iLine' is the bit (iLine % CBOFILE_NB_LINE_PER_WORD) of the
+  // word (iLine / CBOFILE_NB_LINE_PER_WORD)
+  uint64_t* lineFlags[CBoLineFlag_nb];
+
+  // Bitsets of the lines where the errors of each type are suppressed,
+  // the one of type 'type' starts at the word (type * nbWord), NULL if
+  // the file contains no suppression comment
+  uint64_t* suppressed;
+
+  // Original content of the lines changed or removed by the fixes, by
+  // index of the line in the file as loaded, and number of lines of the
+  // file as loaded, NULL if the diff of the fixes is not displayed
+  char** strOrig;
+  unsigned int nbLineOrig;
+
+  // States of the calculation of the indentation levels at the start of
+  // every CBOFILE_INDENT_NB_LINE_CHECKPOINT lines, and their number,
+  // NULL if the indentation levels haven't been calculated
+  struct CBoIndentState* indentCheckpoints;
+  unsigned int nbIndentCheckpoint;
+
+  // Maximum number of errors memorized for this file, 0 if there is no
+  // limit
+  unsigned int nbMaxError;
+
+  // Mask of the rules (1 << CBoRuleId) considered as failed before the
+  // check of the file, the ones failed on the whole file when it's a
+  // view of a range of its lines
+  unsigned int failedRules;
+
+  // Buffer of the output of the check of the file, and its size
+  char* output;
+  size_t outputSize;
+
+  // Flag to memorize if the check of the file is completed
+  bool isChecked;
+
+  // Flag to memorize if the file is correct
+  bool isCorrect;
+
+  // Flag to memorize if the check of the file was aborted, because it
+  // crashed or exceeded its time budget when checked in isolation
+  bool isAborted;
+
+  // Measured time of the check of the file, in seconds
+  double checkTime;
+
+  // Error state of the CBo which created the file
+  PBErr* err;
+
 } CBoFile;
 
+// Structure to memorize one line of the diff of the fixes of a file
+typedef struct CBoDiffLine {
+
+  // Content of the line
+  const char* str;
+
+  // Index plus one of the line in the original and fixed file, 0 if
+  // it's not in the file
+  unsigned int iOrig;
+  unsigned int iFixed;
+
+} CBoDiffLine;
+
+// Enum for the flags of the state of the calculation of the
+// indentation levels
+typedef enum CBoIndentFlag {
+
+  // The current line continues a line ending with '='
+  CBoIndentFlag_multiline = 1 << 0,
+
+  // The current line is inside parenthesis
+  CBoIndentFlag_inParenthesis = 1 << 1,
+
+  // The current line is inside a for (...)
+  CBoIndentFlag_for = 1 << 2,
+
+  // The current line is inside a case ...
+  CBoIndentFlag_case = 1 << 3,
+
+  // Number of combinations of flags
+  CBoIndentFlag_nb = 1 << 4
+
+} CBoIndentFlag;
+
+// Enum for the properties of a line used to calculate the indentation
+// levels
+typedef enum CBoIndentLineProp {
+
+  // The line starts with 'for ('
+  CBoIndentLineProp_for = 1 << 0,
+
+  // The line starts with 'case ' or 'default:'
+  CBoIndentLineProp_case = 1 << 1,
+
+  // The line starts with '}' and is not a precompiler command
+  CBoIndentLineProp_closeCurly = 1 << 2,
+
+  // The line is not empty, not a comment, not a precompiler command,
+  // and ends with '{', '(', '=', ';' or ':'
+  CBoIndentLineProp_openCurly = 1 << 3,
+  CBoIndentLineProp_openParenthesis = 1 << 4,
+  CBoIndentLineProp_equal = 1 << 5,
+  CBoIndentLineProp_semicolon = 1 << 6,
+  CBoIndentLineProp_colon = 1 << 7,
+
+  // The line starts with 'break;'
+  CBoIndentLineProp_break = 1 << 8
+
+} CBoIndentLineProp;
+
+// Structure of the state of the calculation of the indentation levels
+typedef struct CBoIndentState {
+
+  // Current indentation level
+  unsigned int indent;
+
+  // Current flags, combination of CBoIndentFlag
+  unsigned int flags;
+
+} CBoIndentState;
+
+// Structure of a chunk of lines when the indentation levels of a file
+// are calculated in parallel
+typedef struct CBoIndentChunk {
+
+  // The file
+  CBoFile* file;
+
+  // Properties of the lines of the file, combinations of
+  // CBoIndentLineProp
+  unsigned short* props;
+
+  // Index of the first line and number of lines of the chunk
+  unsigned int iFirstLine;
+  unsigned int nbLine;
+
+  // Summary of the chunk as a function of the incoming flags: the
+  // outgoing flags and the variation of the indentation level
+  unsigned int flagsOut[CBoIndentFlag_nb];
+  unsigned int deltaIndent[CBoIndentFlag_nb];
+
+  // Incoming state of the chunk
+  CBoIndentState stateIn;
+
+} CBoIndentChunk;
+
+// Enum for the colors of the output
+typedef enum CBoColor {
+
+  CBoColor_error,
+  CBoColor_errorLine,
+  CBoColor_fileHeader,
+  CBoColor_nb
+
+} CBoColor;
+
 // Enum for the error type
 typedef enum CBoErrorType {
 
@@ -77,9 +394,31 @@ typedef enum CBoErrorType {
   CBoErrorType_EmptyLineBeforeCase,
   CBoErrorType_MacroNameMustBeCapital,
   CBoErrorType_LineContinuationMarksMustBeAligned,
+  CBoErrorType_nb
 
 } CBoErrorType;
 
+// Enum for the kinds of fix of the errors
+typedef enum CBoFixKind {
+
+  // The error can't be fixed
+  CBoFixKind_none = 0,
+
+  // The content of the line of the error is fixed
+  CBoFixKind_content = 1 << 0,
+
+  // An empty line is inserted before the line of the error
+  CBoFixKind_insert = 1 << 1,
+
+  // The line of the error is removed
+  CBoFixKind_remove = 1 << 2,
+
+  // The indentation of the line is rewritten to its computed level,
+  // only if the files are reindented
+  CBoFixKind_indent = 1 << 3
+
+} CBoFixKind;
+
 // Structure to memorize the info about one error
 typedef struct CBoError {
 
@@ -97,10 +436,571 @@ typedef struct CBoError {
 
 } CBoError;
 
+// Type of the functions checking one rule on a CBoFile
+typedef bool (*CBoFileCheckFun)(
+  CBoFile* const that,
+      CBo* const cbo);
+
+// Enum for the identifiers of the rules, in their default order of
+// check
+typedef enum CBoRuleId {
+
+  CBoRuleId_LineLength,
+  CBoRuleId_TrailingSpace,
+  CBoRuleId_ContinuationMark,
+  CBoRuleId_TabIndent,
+  CBoRuleId_EmptyLineBeforeClosingCurlyBrace,
+  CBoRuleId_EmptyLineAfterOpeningCurlyBrace,
+  CBoRuleId_EmptyLineAfterClosingCurlyBrace,
+  CBoRuleId_SpaceAroundComma,
+  CBoRuleId_SpaceAroundSemicolon,
+  CBoRuleId_SpaceAroundOperator,
+  CBoRuleId_SeveralBlankLines,
+  CBoRuleId_NoCurlyBraceAtHead,
+  CBoRuleId_NoCurlyBraceAtTail,
+  CBoRuleId_CharBeforeDot,
+  CBoRuleId_SpaceBeforeOpenCurlyBrace,
+  CBoRuleId_EmptyLineBeforeComment,
+  CBoRuleId_SeveralArgOnOneLine,
+  CBoRuleId_AlignmentArg,
+  CBoRuleId_EmptyLineBeforeCase,
+  CBoRuleId_IndentLevel,
+  CBoRuleId_nb
+
+} CBoRuleId;
+
+// Structure to describe one rule
+typedef struct CBoRule {
+
+  // Function checking the rule
+  CBoFileCheckFun check;
+
+  // Label of the rule
+  const char* label;
+
+  // Type of the errors of the rule
+  CBoErrorType errorType;
+
+  // Mask of the rules (1 << CBoRuleId) which must have passed for this
+  // rule to be checked
+  unsigned int prerequisites;
+
+} CBoRule;
+
+// Structure to memorize the result of the check of one rule on a
+// file, when the rules of the file are checked in parallel
+typedef struct CBoRuleRun {
+
+  // Copy of the checked file, sharing its lines but with its own set
+  // of errors
+  CBoFile file;
+
+  // Copy of the CBo, with its own output stream
+  CBo cbo;
+
+  // Buffer of the output of the check of the rule, and its size
+  char* output;
+  size_t outputSize;
+
+  // Result of the check of the rule
+  bool success;
+
+} CBoRuleRun;
+
+// Structure of the queue of rules shared by the threads checking the
+// rules of one file in parallel
+typedef struct CBoRuleRunQueue {
+
+  // Array of the runs, one per rule
+  CBoRuleRun* runs;
+
+  // Index of the next rule to be picked by a thread
+  unsigned int iNextRule;
+
+} CBoRuleRunQueue;
+
+// Structure of a deque of files to check, owned by one thread which
+// picks files from its head, the other threads stealing files from its
+// tail when their own deque is empty
+typedef struct CBoCheckDeque {
+
+  // Array of the files in the deque
+  CBoFile** files;
+
+  // Index of the head and tail of the deque in 'files', the deque is
+  // empty when they are equal
+  unsigned int head;
+  unsigned int tail;
+
+} CBoCheckDeque;
+
+// Structure to memorize the check time of one file during a previous
+// run
+typedef struct CBoTiming {
+
+  // Path of the file
+  char* path;
+
+  // Check time of the file, in seconds
+  double time;
+
+} CBoTiming;
+
+// Structure to memorize the estimated cost of the check of one file
+typedef struct CBoPathCost {
+
+  // Index of the file in the order of the arguments
+  unsigned int iPath;
+
+  // Estimated cost of the check of the file
+  double cost;
+
+} CBoPathCost;
+
+// Enum for the result of the check of a file in a partial result
+typedef enum CBoFileStatus {
+
+  CBoFileStatus_correct,
+  CBoFileStatus_error,
+  CBoFileStatus_loadFailed,
+  CBoFileStatus_nb
+
+} CBoFileStatus;
+
+// Structure to memorize the result of one file read from a partial
+// result
+typedef struct CBoPartialRecord {
+
+  // Flag to memorize if the result of the file has been read
+  bool isRead;
+
+  // Result of the check of the file
+  CBoFileStatus status;
+
+  // Number of errors of the file
+  unsigned int nbError;
+
+  // Report of the file, as displayed by an unsharded run, and its size
+  char* report;
+  size_t reportSize;
+
+} CBoPartialRecord;
+
+// Structure of the coordinator distributing the files to the worker
+// processes connected on its socket, in batches as they become free
+typedef struct CBoCoordinator {
+
+  // Copy of the CBo whose files are distributed, made before starting
+  // the threads
+  CBo cbo;
+
+  // Socket listening for the worker processes
+  int socket;
+
+  // Number of files and their paths, in the order of the command line
+  unsigned int nbPath;
+  const char** paths;
+
+  // Results of the files received from the worker processes
+  CBoPartialRecord* records;
+
+  // Index of the next file never sent to a worker process
+  unsigned int iNextPath;
+
+  // Files sent to worker processes which disconnected before sending
+  // their result, to be sent again
+  unsigned int* retryPaths;
+  unsigned int nbRetry;
+
+  // Number of connected worker processes
+  unsigned int nbWorker;
+
+  // Flag to stop distributing the files
+  bool flagStop;
+
+  // Mutex protecting the coordinator, condition signaling a new result
+  // and condition signaling new files to send or the stop
+  pthread_mutex_t mutex;
+  pthread_cond_t condRead;
+  pthread_cond_t condWork;
+
+} CBoCoordinator;
+
+// Structure of the connection of the coordinator with one worker
+// process
+typedef struct CBoWorkerLink {
+
+  // Coordinator
+  CBoCoordinator* coordinator;
+
+  // Connected socket
+  int socket;
+
+  // Thread serving the worker process
+  pthread_t thread;
+
+} CBoWorkerLink;
+
+// Structure to memorize the key of a file when selecting a sample of
+// the files
+typedef struct CBoSampleKey {
+
+  // Path of the file
+  char* path;
+
+  // Length of the directory of the file in its path
+  unsigned int lengthDir;
+
+  // Pseudo random key of the file, from its path and the seed
+  uint64_t key;
+
+  // Index of the file in the order of the arguments
+  unsigned int iPath;
+
+} CBoSampleKey;
+
+// Structure of the ring in shared memory through which the child
+// process checking a file in isolation sends its result to the parent
+// process
+typedef struct CBoIsolateRing {
+
+  // Semaphore posted by the child process when it writes data, and by
+  // the parent process when it reads data
+  sem_t semData;
+  sem_t semSpace;
+
+  // Total number of bytes written by the child process and read by the
+  // parent process, the position in the ring is modulo its size
+  size_t head;
+  size_t tail;
+
+  // Data of the ring
+  char data[CBO_ISOLATE_RING_SIZE];
+
+} CBoIsolateRing;
+
+// Structure of the result of the check of a file in isolation, sent
+// before its errors and its output
+typedef struct CBoIsolateHeader {
+
+  // Flag to memorize if the file is correct
+  bool isCorrect;
+
+  // Number of errors of the file
+  unsigned int nbError;
+
+  // Size of the output of the check of the file
+  size_t outputSize;
+
+} CBoIsolateHeader;
+
+// Structure of an error of a file checked in isolation
+typedef struct CBoIsolateError {
+
+  // Index of the line of the error
+  unsigned int iLine;
+
+  // Type of the error
+  CBoErrorType type;
+
+} CBoIsolateError;
+
+// Structure of the head of the binary output. It's followed by the
+// records, the index of the paths, the paths and the CBoBinaryTail, so
+// the output can be written as the files are checked and read directly
+// from a mapping of the file
+typedef struct CBoBinaryHead {
+
+  // Magic number, CBO_BINARY_MAGIC
+  char magic[8];
+
+  // Version, CBO_BINARY_VERSION, which also detects an output written
+  // with another byte order
+  uint32_t version;
+
+  // Size in bytes of one record
+  uint32_t recordSize;
+
+} CBoBinaryHead;
+
+// Structure of a record of the binary output
+typedef struct CBoBinaryRecord {
+
+  // Index of the file in the index of the paths
+  uint32_t iFile;
+
+  // Index of the line, 0 if the record concerns the whole file
+  uint32_t iLine;
+
+  // Rule, a CBoErrorType, CBO_RULE_LOAD_FAILED or
+  // CBO_RULE_CHECK_ABORTED
+  uint32_t rule;
+
+  // Hash of the content of the line, 0 if the record concerns the
+  // whole file
+  uint32_t lineHash;
+
+} CBoBinaryRecord;
+
+// Structure of the tail of the binary output
+typedef struct CBoBinaryTail {
+
+  // Offset in bytes of the index of the paths from the head of the
+  // output. The index is the offset of each path, null terminated, from
+  // the end of the index
+  uint64_t pathsOffset;
+
+  // Number of files and number of records
+  uint32_t nbFile;
+  uint32_t nbRecord;
+
+  // Magic number, CBO_BINARY_MAGIC
+  char magic[8];
+
+} CBoBinaryTail;
+
+// Structure of the baseline of the known errors, an open addressing
+// hash set, with linear probing, of the keys of the errors
+typedef struct CBoBaseline {
+
+  // Slots of the hash set, 0 for an empty slot
+  uint64_t* keys;
+
+  // Number of slots, a power of 2, and number of keys
+  size_t nbSlot;
+  size_t nbKey;
+
+  // Error state of the CBo which created the baseline
+  PBErr* err;
+
+} CBoBaseline;
+
+// Structure to memorize the entry in the baseline of an error of a
+// file
+typedef struct CBoBaselineEntry {
+
+  // Error
+  CBoError* error;
+
+  // Index of the error in the errors of the file
+  unsigned int iError;
+
+  // Hash of the content of the line of the error
+  uint32_t lineHash;
+
+  // Index of the error among the errors of the file with the same rule
+  // and the same line content
+  unsigned int occurrence;
+
+} CBoBaselineEntry;
+
+// Structure of the progress reporter of the check of the files. The
+// checker threads memorize their progress in it, and the thread
+// displaying the reports displays it on the terminal at a limited rate
+typedef struct CBoProgress {
+
+  // Terminal on which the progress is displayed
+  FILE* stream;
+
+  // Number of files to check, and number of checked files
+  unsigned int nbFile;
+  unsigned int nbFileChecked;
+
+  // Path of the last file whose check started, and last rule which
+  // reported its progress, with its progress in thousandths
+  const char* path;
+  const char* rule;
+  unsigned int permille;
+
+  // Time of the last display, and flag to memorize if the progress is
+  // currently displayed
+  struct timespec lastDraw;
+  bool isDrawn;
+
+} CBoProgress;
+
+// Structure of the pipeline checking the files: loader threads load
+// the files, the most expensive first, and queue them on the deques of
+// the checker threads, the current thread emits the output of the
+// files in the order of the arguments
+typedef struct CBoPipeline {
+
+  // Copy of the CBo whose files are checked, made before starting the
+  // threads so they never read the CBo while it's updated
+  CBo cbo;
+
+  // Number of files
+  unsigned int nbFile;
+
+  // Paths of the files, in the order of the arguments
+  const char** paths;
+
+  // Loaded files, in the order of the arguments, NULL until they are
+  // loaded
+  CBoFile** files;
+
+  // Flags to memorize the files picked by a loader thread and the
+  // ones which couldn't be loaded, in the order of the arguments
+  bool* isPicked;
+  bool* isLoadFailed;
+
+  // Estimated memory used by each file once loaded, in the order of
+  // the arguments
+  size_t* sizes;
+
+  // Indices of the files in the order they are loaded
+  unsigned int* schedule;
+
+  // Position in 'schedule' of the next file to load
+  unsigned int iSchedule;
+
+  // Number of files picked by a loader thread and completely loaded
+  // or failed
+  unsigned int nbLoaded;
+
+  // Deques of loaded files waiting to be checked, one per checker
+  // thread
+  CBoCheckDeque* deques;
+
+  // Number of deques
+  unsigned int nbDeque;
+
+  // Index of the deque of the next checker thread to start
+  unsigned int iNextDeque;
+
+  // Number of files queued on the deques and the maximum number of
+  // queued files
+  unsigned int nbQueued;
+  unsigned int nbMaxQueued;
+
+  // Memory used by the loaded files not emitted yet, and its maximum,
+  // 0 if there is no maximum
+  size_t memory;
+  size_t maxMemory;
+
+  // Index of the file whose output is awaited by the current thread
+  unsigned int iEmit;
+
+  // Flag to stop the threads
+  bool flagStop;
+
+  // Mutex protecting the pipeline, conditions to signal a new file on
+  // the deques, some free space in the deques or memory, and the end of
+  // the check of a file
+  pthread_mutex_t mutex;
+  pthread_cond_t condQueued;
+  pthread_cond_t condSpace;
+  pthread_cond_t condDone;
+
+} CBoPipeline;
+
+// Enum for the classes of characters used by the state machine of the
+// SpaceAroundOperator rule
+typedef enum CBoOpCharClass {
+
+  CBoOpCharClass_other,
+  CBoOpCharClass_end,
+  CBoOpCharClass_space,
+  CBoOpCharClass_ident,
+  CBoOpCharClass_digit,
+  CBoOpCharClass_dot,
+  CBoOpCharClass_doubleQuote,
+  CBoOpCharClass_quote,
+  CBoOpCharClass_backslash,
+  CBoOpCharClass_open,
+  CBoOpCharClass_close,
+  CBoOpCharClass_separator,
+  CBoOpCharClass_punctuation,
+  CBoOpCharClass_slash,
+  CBoOpCharClass_star,
+  CBoOpCharClass_operator,
+  CBoOpCharClass_nb
+
+} CBoOpCharClass;
+
+// Enum for the lexical states of the state machine of the
+// SpaceAroundOperator rule
+typedef enum CBoOpLexState {
+
+  CBoOpLexState_code,
+  CBoOpLexState_string,
+  CBoOpLexState_stringEscape,
+  CBoOpLexState_char,
+  CBoOpLexState_charEscape,
+  CBoOpLexState_comment,
+  CBoOpLexState_commentStar,
+  CBoOpLexState_nb
+
+} CBoOpLexState;
+
+// Enum for the kind of the previous significant token in the state
+// machine of the SpaceAroundOperator rule
+typedef enum CBoOpToken {
+
+  // After an opening bracket or a comma
+  CBoOpToken_start,
+
+  // Head of line, or after a curly brace or a semicolon
+  CBoOpToken_statement,
+
+  // Identifier
+  CBoOpToken_ident,
+
+  // Keyword followed by an operand (return, case, sizeof)
+  CBoOpToken_keyword,
+
+  // Type keyword or qualifier (int, const, struct, ...)
+  CBoOpToken_type,
+
+  // Closing parenthesis of a cast
+  CBoOpToken_cast,
+
+  // Number, string, character, ) or ]
+  CBoOpToken_operand,
+
+  // Operator or punctuation expecting an operand after it
+  CBoOpToken_operator,
+
+  // Pointer operator in a type
+  CBoOpToken_pointer
+
+} CBoOpToken;
+
+// Enum for the kinds of operator in the SpaceAroundOperator rule
+typedef enum CBoOpKind {
+
+  CBoOpKind_none,
+  CBoOpKind_binary,
+  CBoOpKind_unary,
+  CBoOpKind_pointer,
+  CBoOpKind_increment,
+  CBoOpKind_compound,
+  CBoOpKind_arrow
+
+} CBoOpKind;
+
+// Structure to describe one operator character in the
+// SpaceAroundOperator rule
+typedef struct CBoOpDesc {
+
+  // Flag to memorize if the character is an operator
+  bool isOperator;
+
+  // Kind of the operator when the character is doubled (++, &&, ...)
+  CBoOpKind doubleKind;
+
+  // Flag to memorize if the operator can be unary
+  bool canBeUnary;
+
+  // Flag to memorize if the operator can be a pointer operator
+  bool canBePointer;
+
+} CBoOpDesc;
+
 // ================= Global variables ===================
 
 // Label for the file types
-const char* cboFileTypeStr[] = {
+const char* const cboFileTypeStr[] = {
 
   "unknown",
   "C header",
@@ -109,7 +1009,7 @@ const char* cboFileTypeStr[] = {
 };
 
 // Label for the error types
-const char* cboErrorTypeStr[] = {
+const char* const cboErrorTypeStr[] = {
 
   "Line too long",
   "Trailing space(s) or tab(s)",
@@ -135,37 +1035,346 @@ const char* cboErrorTypeStr[] = {
 
 };
 
-// ================ Functions declaration ==================
+// Identifier of the error types in the JSON Lines and SARIF outputs,
+// stable across versions
+const char* const cboErrorTypeId[] = {
+
+  "LineLength",
+  "TrailingSpace",
+  "EmptyLineBeforeClosingCurlyBrace",
+  "EmptyLineAfterOpeningCurlyBrace",
+  "EmptyLineAfterClosingCurlyBrace",
+  "SpaceAroundComma",
+  "SpaceAroundSemicolon",
+  "SpaceAroundOperator",
+  "SeveralBlankLine",
+  "NoCurlyBraceAtHead",
+  "NoCurlyBraceAtTail",
+  "CharBeforeDot",
+  "SpaceBeforeOpeningCurlyBrace",
+  "EmptyLineBeforeComment",
+  "IndentLevel",
+  "SeveralArgOnOneLine",
+  "ArgumentsUnaligned",
+  "IndentTab",
+  "EmptyLineBeforeCase",
+  "MacroNameMustBeCapital",
+  "LineContinuationMarksMustBeAligned",
 
-// Function to create a new CBoFile from its file path,
-// Return a pointer to the new CBoFile
-CBoFile* CBoFileCreate(const char* const filePath);
+};
 
-// Function to free the memory used by the CBoFile 'that'
-void CBoFileFree(CBoFile** const that);
+// Identifier and description of the rules of the records concerning a
+// whole file, after the error types
+const char* const cboFileRuleId[] = {
 
-// Calculate the proper indentation level of each line of the
-// CBoFile 'that'
-void CBoFileUpdateIndentLvlLines(CBoFile* const that);
+  "LoadFailed",
+  "CheckAborted",
 
-// Function to add the CBoError 'error' to the CBoFile 'that'
-void CBoFileAddError(
-   CBoFile* const that,
-  CBoError* const error);
+};
+const char* const cboFileRuleStr[] = {
 
-// Display the errors of the CBoFile 'that' on the FILE 'stream'
-void CBoFilePrintErrors(
-  CBoFile* const that,
-           FILE* stream);
+  "Failed to load the file",
+  "The check of the file was aborted",
 
-// Function to create a new CBoLine from its content,
-// Return a pointer to the new CBoLine
-CBoLine* CBoLineCreate(const char* const str);
+};
 
-// Function to free the memory used by the CBoLine 'that'
-void CBoLineFree(CBoLine** const that);
+// Kind of fix of each error type
+const CBoFixKind cboErrorTypeFix[CBoErrorType_nb] = {
+
+  [CBoErrorType_TrailingSpace] = CBoFixKind_content,
+  [CBoErrorType_IndentTab] = CBoFixKind_content,
+  [CBoErrorType_SpaceAroundComma] = CBoFixKind_content,
+  [CBoErrorType_SpaceAroundSemicolon] = CBoFixKind_content,
+  [CBoErrorType_SeveralBlankLine] = CBoFixKind_remove,
+  [CBoErrorType_EmptyLineBeforeClosingCurlyBrace] = CBoFixKind_insert,
+  [CBoErrorType_EmptyLineAfterOpeningCurlyBrace] = CBoFixKind_insert,
+  [CBoErrorType_EmptyLineAfterClosingCurlyBrace] = CBoFixKind_insert,
+  [CBoErrorType_EmptyLineBeforeComment] = CBoFixKind_insert,
+  [CBoErrorType_EmptyLineBeforeCase] = CBoFixKind_insert,
+  [CBoErrorType_IndentLevel] = CBoFixKind_indent,
 
-// Return the position of the last character 'c' excluding the string
+};
+
+// Escape sequences starting each color of the output, the same as the
+// ones of SGR_ColorFG and SGR_ColorBG, and the one ending a color
+const char* const cboColorStart[CBoColor_nb] = {
+
+  "\033[38;2;255;0;0m",
+  "\033[48;2;50;50;50m",
+  "\033[38;2;125;125;255m",
+
+};
+const char* const cboColorEnd = "\033[0m";
+
+// Class of each character for the state machine of the
+// SpaceAroundOperator rule
+const unsigned char cboOpCharClass[256] = {
+
+  ['\0'] = CBoOpCharClass_end,
+  [' '] = CBoOpCharClass_space,
+  ['\t'] = CBoOpCharClass_space,
+  ['_'] = CBoOpCharClass_ident,
+  ['a' ... 'z'] = CBoOpCharClass_ident,
+  ['A' ... 'Z'] = CBoOpCharClass_ident,
+  ['0' ... '9'] = CBoOpCharClass_digit,
+  ['.'] = CBoOpCharClass_dot,
+  ['"'] = CBoOpCharClass_doubleQuote,
+  ['\''] = CBoOpCharClass_quote,
+  ['\\'] = CBoOpCharClass_backslash,
+  ['('] = CBoOpCharClass_open,
+  ['['] = CBoOpCharClass_open,
+  [')'] = CBoOpCharClass_close,
+  [']'] = CBoOpCharClass_close,
+  ['{'] = CBoOpCharClass_separator,
+  ['}'] = CBoOpCharClass_separator,
+  [','] = CBoOpCharClass_separator,
+  [';'] = CBoOpCharClass_separator,
+  ['='] = CBoOpCharClass_punctuation,
+  ['<'] = CBoOpCharClass_punctuation,
+  ['>'] = CBoOpCharClass_punctuation,
+  ['!'] = CBoOpCharClass_punctuation,
+  ['~'] = CBoOpCharClass_punctuation,
+  ['?'] = CBoOpCharClass_punctuation,
+  [':'] = CBoOpCharClass_punctuation,
+  ['/'] = CBoOpCharClass_slash,
+  ['*'] = CBoOpCharClass_star,
+  ['+'] = CBoOpCharClass_operator,
+  ['-'] = CBoOpCharClass_operator,
+  ['%'] = CBoOpCharClass_operator,
+  ['&'] = CBoOpCharClass_operator,
+  ['|'] = CBoOpCharClass_operator,
+  ['^'] = CBoOpCharClass_operator,
+
+};
+
+// Transitions of the lexical states for the state machine of the
+// SpaceAroundOperator rule, the code state is left only through the
+// quotes here, comments are detected with a lookahead on '/'
+const unsigned char cboOpLexTransition[][CBoOpCharClass_nb] = {
+
+  [CBoOpLexState_code] = {
+
+    [CBoOpCharClass_other ... CBoOpCharClass_dot] = CBoOpLexState_code,
+    [CBoOpCharClass_doubleQuote] = CBoOpLexState_string,
+    [CBoOpCharClass_quote] = CBoOpLexState_char,
+    [CBoOpCharClass_backslash] = CBoOpLexState_code,
+    [CBoOpCharClass_open ... CBoOpCharClass_operator] = CBoOpLexState_code,
+
+  },
+  [CBoOpLexState_string] = {
+
+    [CBoOpCharClass_other ... CBoOpCharClass_dot] = CBoOpLexState_string,
+    [CBoOpCharClass_doubleQuote] = CBoOpLexState_code,
+    [CBoOpCharClass_quote] = CBoOpLexState_string,
+    [CBoOpCharClass_backslash] = CBoOpLexState_stringEscape,
+    [CBoOpCharClass_open ... CBoOpCharClass_operator] = CBoOpLexState_string,
+
+  },
+  [CBoOpLexState_stringEscape] = {
+
+    [CBoOpCharClass_other ... CBoOpCharClass_operator] = CBoOpLexState_string,
+
+  },
+  [CBoOpLexState_char] = {
+
+    [CBoOpCharClass_other ... CBoOpCharClass_doubleQuote] = CBoOpLexState_char,
+    [CBoOpCharClass_quote] = CBoOpLexState_code,
+    [CBoOpCharClass_backslash] = CBoOpLexState_charEscape,
+    [CBoOpCharClass_open ... CBoOpCharClass_operator] = CBoOpLexState_char,
+
+  },
+  [CBoOpLexState_charEscape] = {
+
+    [CBoOpCharClass_other ... CBoOpCharClass_operator] = CBoOpLexState_char,
+
+  },
+  [CBoOpLexState_comment] = {
+
+    [CBoOpCharClass_other ... CBoOpCharClass_slash] = CBoOpLexState_comment,
+    [CBoOpCharClass_star] = CBoOpLexState_commentStar,
+    [CBoOpCharClass_operator] = CBoOpLexState_comment,
+
+  },
+  [CBoOpLexState_commentStar] = {
+
+    [CBoOpCharClass_other ... CBoOpCharClass_quote] = CBoOpLexState_comment,
+    [CBoOpCharClass_backslash ... CBoOpCharClass_open] = CBoOpLexState_comment,
+    [CBoOpCharClass_close] = CBoOpLexState_comment,
+    [CBoOpCharClass_separator] = CBoOpLexState_comment,
+    [CBoOpCharClass_punctuation] = CBoOpLexState_comment,
+    [CBoOpCharClass_slash] = CBoOpLexState_code,
+    [CBoOpCharClass_star] = CBoOpLexState_commentStar,
+    [CBoOpCharClass_operator] = CBoOpLexState_comment,
+
+  },
+
+};
+
+// Description of the operator characters for the SpaceAroundOperator
+// rule
+const CBoOpDesc cboOpDesc[256] = {
+
+  ['+'] = {true, CBoOpKind_increment, true, false},
+  ['-'] = {true, CBoOpKind_increment, true, false},
+  ['*'] = {true, CBoOpKind_none, true, true},
+  ['/'] = {true, CBoOpKind_none, false, false},
+  ['%'] = {true, CBoOpKind_none, false, false},
+  ['&'] = {true, CBoOpKind_binary, true, false},
+  ['|'] = {true, CBoOpKind_binary, false, false},
+  ['^'] = {true, CBoOpKind_none, false, false},
+
+};
+
+// Type keywords and qualifiers for the SpaceAroundOperator rule
+const char* const cboOpTypeKeywords[] = {
+
+  "void",
+  "char",
+  "short",
+  "int",
+  "long",
+  "float",
+  "double",
+  "signed",
+  "unsigned",
+  "const",
+  "volatile",
+  "restrict",
+  "struct",
+  "union",
+  "enum",
+  "static",
+  "extern",
+  "register",
+  "inline",
+  "bool",
+  "_Bool",
+
+};
+
+// ================ Functions declaration ==================
+
+// Function to create a new CBoFile from its file path, for the CBo
+// 'cbo' whose threads and error state it uses
+// Return a pointer to the new CBoFile
+CBoFile* CBoFileCreate(
+  const char* const filePath,
+   const CBo* const cbo);
+
+// Function to free the memory used by the CBoFile 'that'
+void CBoFileFree(CBoFile** const that);
+
+// Function to free the memory used by the lines of the CBoFile 'that',
+// once its errors have been displayed
+void CBoFileFreeLines(CBoFile* const that);
+
+// Calculate the proper indentation level of each line of the
+// CBoFile 'that', using up to 'nbThread' threads
+void CBoFileUpdateIndentLvlLines(
+      CBoFile* const that,
+  const unsigned int nbThread);
+
+// Get the properties of the line 'iLine' of the CBoFile 'that' used
+// to calculate the indentation levels
+// Return a combination of CBoIndentLineProp
+unsigned short CBoFileGetIndentLineProp(
+  const CBoFile* const that,
+    const unsigned int iLine);
+
+// Update the CBoIndentState 'that' with a line of properties 'prop'
+// Return the indentation level of the line
+unsigned int CBoIndentStateStep(
+  CBoIndentState* const that,
+   const unsigned short prop);
+
+// Calculate the properties of the lines of the CBoIndentChunk 'arg'
+// and its summary for each combination of incoming flags
+// Return NULL
+void* CBoIndentChunkSummarize(void* arg);
+
+// Calculate the indentation levels of the lines of the CBoIndentChunk
+// 'arg' from its incoming state
+// Return NULL
+void* CBoIndentChunkApply(void* arg);
+
+// Create the array of lines and calculate the bitsets of properties of
+// the lines of the CBoFile 'that'
+void CBoFileUpdateLineFlags(CBoFile* const that);
+
+// Get the kind of the suppression comment on the line 'that', and in
+// 'types' the mask (1 << CBoErrorType) of the error types it names,
+// all of them if it names none
+// Return the kind of the comment
+CBoSuppressKind CBoLineGetSuppressKind(
+  const CBoLine* const that,
+   unsigned int* const types);
+
+// Suppress the errors of the types in the mask (1 << CBoErrorType)
+// 'types' on the line 'iLine' of the CBoFile 'that'
+void CBoFileSuppressLine(
+      CBoFile* const that,
+  const unsigned int iLine,
+  const unsigned int types);
+
+// Get the word 'iWord' of the bitset of the lines of the CBoFile 'that'
+// where the errors of type 'type' are suppressed
+// Return the word
+uint64_t CBoFileGetSuppressedWord(
+  const CBoFile* const that,
+    const CBoErrorType type,
+    const unsigned int iWord);
+
+// Check if the errors of type 'type' are suppressed on the line 'iLine'
+// of the CBoFile 'that'
+// Return true if they are suppressed, else false
+bool CBoFileIsSuppressed(
+  const CBoFile* const that,
+    const unsigned int iLine,
+    const CBoErrorType type);
+
+// Get the mask (1 << CBoRuleId) of the rules whose errors are
+// suppressed on the line 'iLine' of the CBoFile 'that'
+// Return the mask
+unsigned int CBoFileGetSuppressedRules(
+  const CBoFile* const that,
+    const unsigned int iLine);
+
+// Get the word 'iWord' of the bitset 'bitset' shifted by one line, i.e.
+// where the bit of each line is the bit of the previous line in
+// 'bitset' (0 for the first line)
+// Return the shifted word
+uint64_t CBoBitsetGetPrevWord(
+  const uint64_t* const bitset,
+     const unsigned int iWord);
+
+// Add to the CBoFile 'that' one error of type 'type' for each bit set
+// in the word 'word' of index 'iWord' in a bitset of lines
+// Return true if there was no error to add, else false
+bool CBoFileAddErrorsFromWord(
+      CBoFile* const that,
+            uint64_t word,
+  const unsigned int iWord,
+  const CBoErrorType type);
+
+// Function to add the CBoError 'error' to the CBoFile 'that'
+void CBoFileAddError(
+   CBoFile* const that,
+  CBoError* const error);
+
+// Display the errors of the CBoFile 'that' on the stream of the CBo
+// 'cbo'
+void CBoFilePrintErrors(
+  const CBoFile* const that,
+      const CBo* const cbo);
+
+// Function to create a new CBoLine from its content,
+// Return a pointer to the new CBoLine
+CBoLine* CBoLineCreate(const char* const str);
+
+// Function to free the memory used by the CBoLine 'that'
+void CBoLineFree(CBoLine** const that);
+
+// Return the position of the last character 'c' excluding the string
 // content, or the length of the string if the character could not be
 // found
 unsigned int CBoLineGetPosLast(
@@ -184,17 +1393,683 @@ CBoError* CBoErrorCreate(
 // Function to free the memory used by the CBoError 'that'
 void CBoErrorFree(CBoError** const that);
 
-// Function to display the CBoError 'that' on the stream 'stream'
+// Function to display the CBoError 'that' on the stream of the CBo
+// 'cbo'
 void CBoErrorPrint(
   const CBoError* const that,
-            FILE* const stream);
+       const CBo* const cbo);
 
 // Check the CBoFile 'that' with the CBo 'cbo'
+// The rules write only on the stream of 'cbo', which must be owned by
+// the calling thread
 // Return true if there was no problem, else false
 bool CBoFileCheck(
   CBoFile* const that,
       CBo* const cbo);
 
+// Check the lines 'iFirstLine' to 'iLastLine' (from 1) of the CBoFile
+// 'that' with the CBo 'cbo'. The rules are checked on a view of the
+// lines from the top level item containing the first line to the one
+// after the last line, whose indentation levels are calculated from
+// the nearest checkpoint, and only the errors of the range are kept.
+// The rules whose prerequisites fail on the whole file are skipped
+// Return true if there was no problem in the range, else false
+bool CBoFileCheckLines(
+      CBoFile* const that,
+          CBo* const cbo,
+  const unsigned int iFirstLine,
+  const unsigned int iLastLine);
+
+// Check on the whole CBoFile 'that' with the CBo 'cbo' the rules which
+// are prerequisites of other rules, without output and stopping each
+// rule at its first error, the errors are freed
+// Return the mask of the failed rules (1 << CBoRuleId)
+unsigned int CBoFileGetFailedPrerequisites(
+  CBoFile* const that,
+      CBo* const cbo);
+
+// Check if the line 'iLine' of the CBoFile 'that', whose state of the
+// calculation of the indentation levels at its start is 'state', is a
+// boundary of the view of a range check: a line at the top level,
+// starting on the first column and not a precompiler command, the
+// rules can be checked from it without the lines before it
+// Return true if it's a boundary, else false
+bool CBoFileIsRangeBoundary(
+         const CBoFile* const that,
+           const unsigned int iLine,
+  const CBoIndentState* const state);
+
+// Check the CBoFile 'that' with the CBo 'cbo' and fix its errors of
+// the mechanical rules, the output is the one of the check of the
+// fixed file
+// Return true if there was no problem in the fixed file, else false
+bool CBoFileCheckFix(
+  CBoFile* const that,
+      CBo* const cbo);
+
+// Get the kinds of fix applied by the CBo 'that'
+// Return the mask of CBoFixKind
+unsigned int CBoGetFixKinds(const CBo* const that);
+
+// Get the number of errors of the CBoFile 'that' which can be fixed
+// with the kinds of fix in the mask of CBoFixKind 'kinds'
+// Return the number of errors
+unsigned int CBoFileGetNbFixableError(
+  const CBoFile* const that,
+    const unsigned int kinds);
+
+// Check if the CBoError 'that' can be fixed with the kinds of fix in
+// the mask of CBoFixKind 'kinds'. A semicolon at the head of its line
+// can't be moved without joining the lines, its error is not fixable
+// Return true if it can be fixed, else false
+bool CBoErrorIsFixable(
+  const CBoError* const that,
+     const unsigned int kinds);
+
+// Apply the fixes of the errors of the CBoFile 'that' on its lines, in
+// one pass on the lines, and update the properties of the lines with
+// the threads of the CBo 'cbo', the errors are freed
+// Return true if a line was changed, else false
+bool CBoFileApplyFixes(
+  CBoFile* const that,
+      CBo* const cbo);
+
+// Get the content of the line 'that' fixed for the error types in the
+// mask (1 << CBoErrorType) 'types', its indentation is made of 'head'
+// spaces if IndentLevel is in the mask. The allocation failures are
+// reported on 'err'
+// Return the fixed content, to be freed by the caller
+char* CBoLineGetFixedStr(
+  const CBoLine* const that,
+    const unsigned int types,
+    const unsigned int head,
+          PBErr* const err);
+
+// Keep the content of the line 'line' as its original content in the
+// CBoFile 'that', if the original contents are kept and it's the first
+// change of the line
+// Return true if the content was kept, else false
+bool CBoFileKeepStrOrig(
+        CBoFile* const that,
+  const CBoLine* const line);
+
+// Print on the stream 'stream' the unified diff of the fixes of the
+// CBoFile 'that', from the original content of its changed lines
+void CBoFilePrintFixDiff(
+  const CBoFile* const that,
+           FILE* const stream);
+
+// Check if the line 'that' of a diff is a change, the original and
+// fixed files end without newline after their lines 'iEndOrig' and
+// 'iEndFixed' if they are not 0
+// Return true if it's a change, false if it's a line of context
+bool CBoDiffLineIsChange(
+  const CBoDiffLine* const that,
+        const unsigned int iEndOrig,
+        const unsigned int iEndFixed);
+
+// Print on the stream 'stream' the hunk of the 'nb' lines 'diffLines'
+// of a diff, whose first line is preceded by 'nbOrig' lines in the
+// original file and 'nbFixed' lines in the fixed file, the original and
+// fixed files end without newline after their lines 'iEndOrig' and
+// 'iEndFixed' if they are not 0
+void CBoPrintDiffHunk(
+  const CBoDiffLine* const diffLines,
+        const unsigned int nb,
+        const unsigned int nbOrig,
+        const unsigned int nbFixed,
+        const unsigned int iEndOrig,
+        const unsigned int iEndFixed,
+               FILE* const stream);
+
+// Replace the file of the CBoFile 'that' with its lines, through a new
+// file renamed as the file once completely written
+// Return true if the file could be saved, else false
+bool CBoFileSave(const CBoFile* const that);
+
+// Write the 'nb' segments 'segments' in the file 'fd', the segments are
+// updated as they are written
+// Return true if they could be written, else false
+bool CBoWriteSegments(
+      const int fd,
+  struct iovec* segments,
+   unsigned int nb);
+
+// Calculate the mask of the line local rules broken by each line of
+// the CBoFile 'that', using the memoization table of the CBo 'cbo'
+void CBoFileUpdateLocalErrors(
+  CBoFile* const that,
+      CBo* const cbo);
+
+// Check the line 'that' against the LineLength rule
+// Return true if there was no problem, else false
+bool CBoLineCheckLineLength(const CBoLine* const that);
+
+// Check the line 'that' against the TrailingSpace rule
+// Return true if there was no problem, else false
+bool CBoLineCheckTrailingSpace(const CBoLine* const that);
+
+// Check the line 'that' against the TabIndent rule
+// Return true if there was no problem, else false
+bool CBoLineCheckTabIndent(const CBoLine* const that);
+
+// Check the line 'that' against the CharBeforeDot rule
+// Return true if there was no problem, else false
+bool CBoLineCheckCharBeforeDot(const CBoLine* const that);
+
+// Check the line 'that' against the SpaceAroundComma rule
+// Return true if there was no problem, else false
+bool CBoLineCheckSpaceAroundComma(const CBoLine* const that);
+
+// Check the line 'that' against the SpaceAroundSemicolon rule
+// Return true if there was no problem, else false
+bool CBoLineCheckSpaceAroundSemicolon(const CBoLine* const that);
+
+// Check the line 'that' against the SpaceBeforeOpenCurlyBrace rule
+// Return true if there was no problem, else false
+bool CBoLineCheckSpaceBeforeOpenCurlyBrace(const CBoLine* const that);
+
+// Get the mask (1 << CBoRuleId) of the line local rules broken by the
+// line 'that'
+// Return the mask
+unsigned int CBoLineGetLocalErrors(const CBoLine* const that);
+
+// Calculate the 64 bits FNV-1a hash of the 'length' first bytes of
+// 'str'
+// Return the hash
+uint64_t CBoHashFNV1a(
+   const char* const str,
+  const unsigned int length);
+
+// Calculate the 32 bits djb2 hash of the 'length' first bytes of 'str'
+// Return the hash
+uint32_t CBoHashDJB2(
+   const char* const str,
+  const unsigned int length);
+
+// Mix the bits of 'key' with the finalizer of splitmix64, each bit of
+// the result depends on all the bits of 'key'
+// Return the mixed key
+uint64_t CBoHashMix64(const uint64_t key);
+
+// Get the mask of the line local rules broken by the line 'line' from
+// the memoization table of the CBo 'that', or calculate it and
+// memorize it if it's not in the table
+// Return the mask
+unsigned int CBoGetLineLocalErrors(
+            CBo* const that,
+  const CBoLine* const line);
+
+// Calculate the order of check of the rules described by 'rules' such
+// as each rule comes after its prerequisites, keeping the order of
+// 'rules' as much as possible, and memorize it in 'order'
+void CBoRuleGetSchedule(
+  const CBoRule* const rules,
+   unsigned int* const order);
+
+// Check all the rules on the CBoFile 'that' with the CBo 'cbo' in
+// parallel, each rule on its own copy of the file
+// Return the array of the results, indexed by rule identifier
+CBoRuleRun* CBoFileRunRulesParallel(
+  CBoFile* const that,
+      CBo* const cbo);
+
+// Main function of the threads checking the rules of one file in
+// parallel: pick the rules from the CBoRuleRunQueue 'arg' until there
+// is no more rule and check them
+// Return NULL
+void* CBoRuleWorker(void* arg);
+
+// Move the output and errors of the CBoRuleRun 'run' to the CBoFile
+// 'that' and the CBo 'cbo' as if the rule was checked on 'that'
+// Return the result of the check of the rule
+bool CBoFileMergeRuleRun(
+     CBoFile* const that,
+         CBo* const cbo,
+  CBoRuleRun* const run);
+
+// Free the memory used by the array of CBoRuleRun 'that', including
+// the errors of the runs which have not been merged
+void CBoRuleRunsFree(CBoRuleRun** const that);
+
+// Check the files of the CBo 'that' with the pipeline and display
+// their reports. If 'partial' is not NULL, also save the reports in it
+// Return true if all the files were loaded and correct, else false
+bool CBoCheckFiles(
+   CBo* const that,
+  FILE* const partial);
+
+// Main function of the threads loading the files: pick the files
+// from the CBoPipeline 'arg' until there is no more file, load them
+// and queue them for the checker threads
+// Return NULL
+void* CBoLoadWorker(void* arg);
+
+// Main function of the threads checking the files: pick the files
+// from the CBoPipeline 'arg' until there is no more file, check
+// them and memorize their output
+// Return NULL
+void* CBoCheckWorker(void* arg);
+
+// Create the CBoPipeline 'that' for the files of the CBo 'cbo'
+// The number of checker threads is 'nbChecker'
+void CBoPipelineInit(
+  CBoPipeline* const that,
+    const CBo* const cbo,
+  const unsigned int nbChecker);
+
+// Free the memory used by the CBoPipeline 'that'
+void CBoPipelineFree(CBoPipeline* const that);
+
+// Pick the next file to load in the CBoPipeline 'that', waiting for
+// some free space in the deques and memory if necessary. Must be
+// called with the mutex of 'that' locked
+// Return true and set 'iPath' to the index of the file, or return
+// false if there is no more file to load
+bool CBoPipelinePickPath(
+   CBoPipeline* const that,
+  unsigned int* const iPath);
+
+// Queue the loaded CBoFile 'file' on the deques of the CBoPipeline
+// 'that'. Must be called with the mutex of 'that' locked
+void CBoPipelinePushFile(
+  CBoPipeline* const that,
+      CBoFile* const file);
+
+// Pick the next file to check for the thread owning the deque 'iDeque'
+// of the CBoPipeline 'that', from its own deque or stolen from another
+// deque if its own deque is empty, waiting for a file to be loaded if
+// necessary. Must be called with the mutex of 'that' locked
+// Return the file, or NULL if there is no more file to check
+CBoFile* CBoPipelinePickFile(
+  CBoPipeline* const that,
+  const unsigned int iDeque);
+
+// Compare the CBoPathCost 'a' and 'b' by decreasing cost, for qsort
+// Return -1, 0 or 1
+int CBoPathCostCmpDesc(
+  const void* a,
+  const void* b);
+
+// Compare the CBoTiming 'a' and 'b' by path, for qsort and bsearch
+// Return the result of strcmp on their paths
+int CBoTimingCmpPath(
+  const void* a,
+  const void* b);
+
+// Calculate the order of load of the files of the CBoPipeline 'that',
+// the most expensive first, from the timings file of a previous run if
+// available, else from their size
+void CBoPipelineUpdateSchedule(CBoPipeline* const that);
+
+// Save the check time of the files of the CBo 'that' in its timings
+// file
+void CBoSaveTimings(const CBo* const that);
+
+// Keep only the paths of the files in the shard of the CBo 'that',
+// those whose hash modulo the number of shards is the shard index
+// minus one, and memorize their index in the command line
+void CBoSelectShardPaths(CBo* const that);
+
+// Display on the stream of the CBo 'that' the report of the check of
+// the CBoFile 'file' at 'path', NULL if it couldn't be loaded. If
+// 'partial' is not NULL, also save the report in it, with the index
+// 'iPath' of the file in the command line
+void CBoEmitFileReport(
+            CBo* const that,
+     const char* const path,
+  const CBoFile* const file,
+    const unsigned int iPath,
+           FILE* const partial);
+
+// Read from the stream 'fp' the result of one file saved by
+// CBoEmitFileReport, into 'record' and its index in the command line
+// into 'iPath'. Set 'isEnd' to true if there is no more result to read
+// Return true if the result could be read or there is no more
+// result, else false
+bool CBoReadPartialRecord(
+         const CBo* const that,
+              FILE* const fp,
+      unsigned int* const iPath,
+  CBoPartialRecord* const record,
+              bool* const isEnd);
+
+// Read the partial result at 'path' into the array 'records', indexed
+// by the index of the files in the command line, allocated on the
+// first partial result and whose size is memorized in the CBo 'that'.
+// The shards already read are flagged in the array 'isShardRead'
+// Return true if the partial result could be read, else false
+bool CBoReadPartialResult(
+                CBo* const that,
+         const char* const path,
+  CBoPartialRecord** const records,
+              bool** const isShardRead);
+
+// Display the report of the file in the 'record' read from a partial
+// result on the stream of the CBo 'that', and add its result to the
+// totals of 'that' and the flags 'allLoaded' and 'allCorrect'
+void CBoEmitPartialRecord(
+                     CBo* const that,
+  const CBoPartialRecord* const record,
+                    bool* const allLoaded,
+                    bool* const allCorrect);
+
+// Merge the partial results whose paths are the paths of the CBo
+// 'that', display their reports in the order of the command line and
+// memorize their totals
+// Return true if all the files were loaded and correct, else false
+bool CBoMergePartialResults(CBo* const that);
+
+// Distribute the files of the CBo 'that' to the worker processes
+// connecting on its socket and display their results in the order of
+// the command line as they come back
+// Return true if all the files were loaded and correct, else false
+bool CBoCoordinate(CBo* const that);
+
+// Main function of the thread accepting the worker processes on the
+// socket of the CBoCoordinator 'arg', and starting a thread serving
+// each of them, until the coordinator is stopped
+// Return NULL
+void* CBoAcceptWorker(void* arg);
+
+// Main function of the thread serving one worker process through the
+// CBoWorkerLink 'arg': send it batches of files and receive their
+// results until there is no more file or it disconnects
+// Return NULL
+void* CBoServeWorker(void* arg);
+
+// Pick in 'batch' the next files to send to a worker process from the
+// CBoCoordinator 'that', waiting for files to send if necessary. Must
+// be called with the mutex of 'that' locked
+// Return the number of files in the batch, 0 if the coordinator is
+// stopped
+unsigned int CBoCoordinatorPickBatch(
+  CBoCoordinator* const that,
+    unsigned int* const batch);
+
+// Connect the CBo 'that' as a worker process to the coordinator on its
+// socket, and check the batches of files it sends until there is no
+// more file, sending back their results
+// Return true if the connection was successfull, else false
+bool CBoWork(CBo* const that);
+
+// Compare the CBoSampleKey 'a' and 'b' by directory, then by key, for
+// qsort
+// Return -1, 0 or 1
+int CBoSampleKeyCmp(
+  const void* a,
+  const void* b);
+
+// Keep only a sample of the paths of the CBo 'that': in each directory
+// (stratum), the files with the smallest pseudo random keys, in
+// proportion of the percentage of sampling and at least one. The keys
+// depend only on the paths and the seed, hence the sample is the same
+// for the same files and seed
+void CBoSelectSamplePaths(CBo* const that);
+
+// Compare the CBoSampleKey 'a' and 'b' by index in the arguments, for
+// qsort
+// Return -1, 0 or 1
+int CBoSampleKeyCmpIndex(
+  const void* a,
+  const void* b);
+
+// Display the estimation of the number of errors of each type on all
+// the files of the CBo 'that' from its checked sample, with their 95%
+// confidence interval. The stratified estimator of the total is used:
+// sum over the strata of the number of files times the mean of the
+// sampled files
+void CBoPrintSampleEstimate(const CBo* const that);
+
+// Create the ring in shared memory through which the child processes
+// checking the files in isolation send their result to the CBo 'that'
+// Return a pointer to the new CBoIsolateRing
+CBoIsolateRing* CBoIsolateRingCreate(const CBo* const that);
+
+// Free the memory used by the CBoIsolateRing 'that'
+void CBoIsolateRingFree(CBoIsolateRing** const that);
+
+// Empty the CBoIsolateRing 'that' before the check of a new file. The
+// semaphores are created again as the previous child process may have
+// been killed while using them
+void CBoIsolateRingReset(CBoIsolateRing* const that);
+
+// Get in 'time' the absolute time of the clock CLOCK_REALTIME in
+// 'delayMs' milliseconds, but not later than the time 'deadline' of
+// the clock CLOCK_MONOTONIC if it's not NULL
+void CBoGetWaitTime(
+        struct timespec* const time,
+            const unsigned int delayMs,
+  const struct timespec* const deadline);
+
+// Write the 'size' bytes of 'data' in the CBoIsolateRing 'that', from
+// the child process, waiting for the parent process to read them when
+// the ring is full. If the parent process 'parent' ended, end the
+// child process
+void CBoIsolateRingWrite(
+  CBoIsolateRing* const that,
+      const void* const data,
+           const size_t size,
+            const pid_t parent);
+
+// Read 'size' bytes from the CBoIsolateRing 'that' into 'data', from
+// the parent process, waiting for the child process 'pid' to write
+// them until the time 'deadline' of the clock CLOCK_MONOTONIC, or with
+// no limit if it's NULL
+// Return true if the bytes were read, false if the child process ended
+// or the deadline passed before
+bool CBoIsolateRingRead(
+         CBoIsolateRing* const that,
+                   void* const data,
+                  const size_t size,
+                   const pid_t pid,
+  const struct timespec* const deadline);
+
+// Check the CBoFile 'that' with the CBo 'cbo' in a child process, which
+// sends its errors and its output through the CBoIsolateRing 'ring'.
+// If the child process ends abnormally or doesn't end before the time
+// budget of the CBo, it's killed and the file is reported as aborted.
+// The errors of the file are displayed on the stream of the CBo
+// Return true if the file is correct, else false
+bool CBoFileCheckIsolated(
+         CBoFile* const that,
+             CBo* const cbo,
+  CBoIsolateRing* const ring);
+
+// Create the progress reporter of the check of the 'nbFile' files of
+// the CBo 'that'. The progress is displayed only if the stream of the
+// CBo is a terminal
+// Return a pointer to the new CBoProgress, or NULL if the progress is
+// not displayed
+CBoProgress* CBoProgressCreate(
+    const CBo* const that,
+  const unsigned int nbFile);
+
+// Free the memory used by the CBoProgress 'that'
+void CBoProgressFree(CBoProgress** const that);
+
+// Memorize in the CBoProgress 'that' the start of the check of the file
+// at 'path'
+void CBoProgressSetFile(
+  CBoProgress* const that,
+   const char* const path);
+
+// Memorize in the CBoProgress 'that' the end of the check of a file
+void CBoProgressEndFile(CBoProgress* const that);
+
+// Memorize in the CBoProgress 'that' the progress of the check of the
+// rule 'rule', at the step 'iStep' out of 'nbStep'. It's called before
+// the check of each rule of a file, it doesn't display anything
+void CBoProgressSetRule(
+  CBoProgress* const that,
+   const char* const rule,
+  const unsigned int iStep,
+  const unsigned int nbStep);
+
+// Display the CBoProgress 'that' on its terminal, if it hasn't been
+// displayed for CBO_PROGRESS_DELAY_MS milliseconds. Only the thread
+// displaying the reports of the files calls it, so the progress never
+// interleaves with the reports
+void CBoProgressDraw(CBoProgress* const that);
+
+// Erase the CBoProgress 'that' from its terminal, before displaying a
+// report
+void CBoProgressClear(CBoProgress* const that);
+
+// Print on the stream 'stream' the string 'str' as a JSON string,
+// between quotes and with its special characters escaped, without
+// allocating memory
+void CBoPrintJsonString(
+        FILE* const stream,
+  const char* const str);
+
+// Print on the stream 'stream' the head of the records of the file at
+// 'path', in the format of the CBo 'that'. In binary format it's the
+// path, moved to the index of the paths by CBoWriteReport
+void CBoPrintRecordsHead(
+  const CBo* const that,
+       FILE* const stream,
+ const char* const path);
+
+// Print on the stream 'stream' the record of a problem of the file at
+// 'path', at the line 'iLine' (0 if it concerns the whole file), of
+// the rule 'rule' (a CBoErrorType, CBO_RULE_LOAD_FAILED or
+// CBO_RULE_CHECK_ABORTED), whose line content has the hash 'lineHash',
+// in the format of the CBo 'that'. In SARIF format the record is a
+// result preceded by a comma, see CBoWriteReport
+void CBoPrintRecord(
+    const CBo* const that,
+         FILE* const stream,
+   const char* const path,
+  const unsigned int iLine,
+  const unsigned int rule,
+      const uint32_t lineHash);
+
+// Print the records of the errors of the CBoFile 'that' on the stream
+// of the CBo 'cbo', in its format. An aborted check gives one record
+// for the whole file
+void CBoFilePrintRecords(
+  const CBoFile* const that,
+      const CBo* const cbo);
+
+// Write the 'size' bytes of the 'report' of a file on the stream of the
+// CBo 'that'. In SARIF format, each result is preceded by a comma,
+// which is skipped for the first result of the document
+void CBoWriteReport(
+         CBo* const that,
+  const char* const report,
+       const size_t size);
+
+// Write the 'size' bytes of the binary 'report' of a file on the stream
+// of the CBo 'that': memorize its path in the index of the paths and
+// write its records with the index of the file
+void CBoWriteBinaryReport(
+         CBo* const that,
+  const char* const report,
+       const size_t size);
+
+// Print on the stream of the CBo 'that' the head of the output: in
+// SARIF format the head of the document up to the opening of the array
+// of results, in binary format the CBoBinaryHead. The records are then
+// printed as the files are checked
+void CBoPrintOutputHead(CBo* const that);
+
+// Print on the stream of the CBo 'that' the tail of the output: in
+// SARIF format the closing of the array of results, in binary format
+// the index of the paths, the paths and the CBoBinaryTail
+void CBoPrintOutputTail(CBo* const that);
+
+// Render in the format of the CBo 'that' the binary result at 'path',
+// read from a mapping of the file, and add its totals to the ones of
+// 'that'. Set 'isValid' to false if the binary result is invalid
+// Return true if the binary result has no record, else false
+bool CBoRenderBinaryResult(
+         CBo* const that,
+  const char* const path,
+        bool* const isValid);
+
+// Render in the format of the CBo 'that' the binary results whose paths
+// are the paths of 'that', and memorize their totals
+// Return true if the binary results are valid and have no record, else
+// false
+bool CBoRenderBinaryResults(CBo* const that);
+
+// Calculate the hash of the content of the line 'iLine' (starting at
+// 1) of the CBoFile 'that', folded to 32 bits
+// Return the hash, 0 if the line doesn't exist
+uint32_t CBoFileGetLineHash(
+  const CBoFile* const that,
+    const unsigned int iLine);
+
+// Calculate the key in the baseline of the error of rule 'ruleId' in
+// the file at 'path', whose line content has the hash 'lineHash', and
+// which is the 'occurrence'-th error of the file with this rule and
+// this line content
+// Return the key, never 0
+uint64_t CBoBaselineGetKey(
+   const char* const path,
+   const char* const ruleId,
+      const uint32_t lineHash,
+  const unsigned int occurrence);
+
+// Function to create a new empty CBoBaseline, for the CBo 'cbo' whose
+// error state it uses
+// Return a pointer to the new CBoBaseline
+CBoBaseline* CBoBaselineCreate(const CBo* const cbo);
+
+// Function to free the memory used by the CBoBaseline 'that'
+void CBoBaselineFree(CBoBaseline** const that);
+
+// Add the 'key' to the CBoBaseline 'that', growing it to keep it at
+// most half full
+void CBoBaselineAdd(
+  CBoBaseline* const that,
+      const uint64_t key);
+
+// Check if the 'key' is in the CBoBaseline 'that'
+// Return true if the key is in the baseline, else false
+bool CBoBaselineContains(
+  const CBoBaseline* const that,
+            const uint64_t key);
+
+// Load the baseline of the CBo 'that' from its baseline file
+// Return true if the baseline could be loaded, else false
+bool CBoBaselineLoad(CBo* const that);
+
+// Compare the CBoBaselineEntry 'a' and 'b' by rule, then by line
+// content, then by index, for qsort
+// Return -1, 0 or 1
+int CBoBaselineEntryCmpContent(
+  const void* a,
+  const void* b);
+
+// Compare the CBoBaselineEntry 'a' and 'b' by index, for qsort
+// Return -1, 0 or 1
+int CBoBaselineEntryCmpIndex(
+  const void* a,
+  const void* b);
+
+// Get the entries in the baseline of the errors of the CBoFile 'that',
+// in the order of the errors
+// Return the array of entries, to be freed by the caller, NULL if the
+// file has no error
+CBoBaselineEntry* CBoFileGetBaselineEntries(const CBoFile* const that);
+
+// Remove from the errors of the CBoFile 'that' the ones in the baseline
+// of the CBo 'cbo', and keep at most 'nbMaxError' of the others (0 if
+// there is no limit)
+// Return true if the file has no other error, else false
+bool CBoFileApplyBaseline(
+      CBoFile* const that,
+    const CBo* const cbo,
+  const unsigned int nbMaxError);
+
+// Save on the stream 'stream' the entries in the baseline of the
+// errors of the CBoFile 'that'
+void CBoFileSaveBaseline(
+  const CBoFile* const that,
+           FILE* const stream);
+
 // Function to detect the type of a file from its path
 // Return a CBoFileType
 CBoFileType CBoFileGetTypeFromPath(const char* const filePath);
@@ -202,6 +2077,18 @@ CBoFileType CBoFileGetTypeFromPath(const char* const filePath);
 // Return the number of errors in the CBoFile 'that'
 unsigned int CBoFileGetNbError(const CBoFile* const that);
 
+// Return true if the CBoFile 'that' has reached its maximum number of
+// errors, else false
+bool CBoFileIsErrorBudgetSpent(const CBoFile* const that);
+
+// Display the result of the rule labelled 'label' on the stream of the
+// CBo 'cbo', given its success 'success'. Nothing is formatted if the
+// output of the check is not displayed (null stream)
+void CBoPrintRuleResult(
+   const CBo* const cbo,
+  const char* const label,
+         const bool success);
+
 // Check the length of line on the CBoFile 'that' with the CBo 'cbo'
 // Return true if there was no problem, else false
 bool CBoFileCheckLineLength(
@@ -271,6 +2158,39 @@ bool CBoFileCheckSpaceAroundOperator(
   CBoFile* const that,
       CBo* const cbo);
 
+// Get the kind of the operator at position 'pos' in the line 'str'
+// given the two previous significant tokens 'prevToken' and
+// 'prevPrevToken', and memorize its length in 'length'
+// Return the kind of the operator
+CBoOpKind CBoOpGetKind(
+  const unsigned char* const str,
+          const unsigned int pos,
+            const CBoOpToken prevToken,
+            const CBoOpToken prevPrevToken,
+         unsigned int* const length);
+
+// Check if the 'length' first characters of 'str' are a keyword
+// followed by an operand (return, case, sizeof)
+// Return true if it's such a keyword, else false
+bool CBoOpIsKeywordExpectingOperand(
+   const char* const str,
+  const unsigned int length);
+
+// Check if the 'length' first characters of 'str' are a type keyword
+// or a qualifier
+// Return true if it's such a keyword, else false
+bool CBoOpIsTypeKeyword(
+   const char* const str,
+  const unsigned int length);
+
+// Check if the closing parenthesis at position 'pos' in the line 'str'
+// ends a cast, i.e. the parenthesis hold a type name and are not the
+// ones of a function call or a sizeof
+// Return true if it's a cast, else false
+bool CBoOpIsCast(
+  const unsigned char* const str,
+          const unsigned int pos);
+
 // Check there is no opening curly brace on the head of lines of the
 // CBoFile 'that' with the CBo 'cbo'
 // Return true if there was no problem, else false
@@ -386,6 +2306,179 @@ unsigned int CBoLineGetPosLast(
   const CBoLine* const that,
             const char c);
 
+// ================= Global variables ===================
+
+// Description of the rules, the indentation level is calculated from
+// the curly braces at head and tail of lines, and the head and tail
+// of lines can't be trusted if there are tabs or trailing spaces
+const CBoRule cboRules[CBoRuleId_nb] = {
+
+  [CBoRuleId_LineLength] = {
+
+    CBoFileCheckLineLength,
+    "CheckLineLength",
+    CBoErrorType_LineLength,
+    0
+
+  },
+  [CBoRuleId_TrailingSpace] = {
+
+    CBoFileCheckTrailingSpace,
+    "CheckTrailingSpace",
+    CBoErrorType_TrailingSpace,
+    0
+
+  },
+  [CBoRuleId_ContinuationMark] = {
+
+    CBoFileCheckContinuationMark,
+    "CheckContinuationMark",
+    CBoErrorType_LineContinuationMarksMustBeAligned,
+    0
+
+  },
+  [CBoRuleId_TabIndent] = {
+
+    CBoFileCheckTabIndent,
+    "CheckTabIndent",
+    CBoErrorType_IndentTab,
+    0
+
+  },
+  [CBoRuleId_EmptyLineBeforeClosingCurlyBrace] = {
+
+    CBoFileCheckEmptyLineBeforeClosingCurlyBrace,
+    "CheckEmptyLineBeforeClosingCurlyBrace",
+    CBoErrorType_EmptyLineBeforeClosingCurlyBrace,
+    0
+
+  },
+  [CBoRuleId_EmptyLineAfterOpeningCurlyBrace] = {
+
+    CBoFileCheckEmptyLineAfterOpeningCurlyBrace,
+    "CheckEmptyLineAfterOpeningCurlyBrace",
+    CBoErrorType_EmptyLineAfterOpeningCurlyBrace,
+    0
+
+  },
+  [CBoRuleId_EmptyLineAfterClosingCurlyBrace] = {
+
+    CBoFileCheckEmptyLineAfterClosingCurlyBrace,
+    "CheckEmptyLineAfterClosingCurlyBrace",
+    CBoErrorType_EmptyLineAfterClosingCurlyBrace,
+    0
+
+  },
+  [CBoRuleId_SpaceAroundComma] = {
+
+    CBoFileCheckSpaceAroundComma,
+    "CheckSpaceAroundComma",
+    CBoErrorType_SpaceAroundComma,
+    0
+
+  },
+  [CBoRuleId_SpaceAroundSemicolon] = {
+
+    CBoFileCheckSpaceAroundSemicolon,
+    "CheckSpaceAroundSemicolon",
+    CBoErrorType_SpaceAroundSemicolon,
+    0
+
+  },
+  [CBoRuleId_SpaceAroundOperator] = {
+
+    CBoFileCheckSpaceAroundOperator,
+    "CheckSpaceAroundOperator",
+    CBoErrorType_SpaceAroundOperator,
+    0
+
+  },
+  [CBoRuleId_SeveralBlankLines] = {
+
+    CBoFileCheckSeveralBlankLines,
+    "CheckSeveralBlankLine",
+    CBoErrorType_SeveralBlankLine,
+    0
+
+  },
+  [CBoRuleId_NoCurlyBraceAtHead] = {
+
+    CBoFileCheckNoCurlyBraceAtHead,
+    "CheckNoCurlyBraceAtHead",
+    CBoErrorType_NoCurlyBraceAtHead,
+    0
+
+  },
+  [CBoRuleId_NoCurlyBraceAtTail] = {
+
+    CBoFileCheckNoCurlyBraceAtTail,
+    "CheckNoCurlyBraceAtTail",
+    CBoErrorType_NoCurlyBraceAtTail,
+    0
+
+  },
+  [CBoRuleId_CharBeforeDot] = {
+
+    CBoFileCheckCharBeforeDot,
+    "CheckCharBeforeDot",
+    CBoErrorType_CharBeforeDot,
+    0
+
+  },
+  [CBoRuleId_SpaceBeforeOpenCurlyBrace] = {
+
+    CBoFileCheckSpaceBeforeOpenCurlyBrace,
+    "CheckSpaceBeforeOpenCurlyBrace",
+    CBoErrorType_SpaceBeforeOpeningCurlyBrace,
+    0
+
+  },
+  [CBoRuleId_EmptyLineBeforeComment] = {
+
+    CBoFileCheckEmptyLineBeforeComment,
+    "CheckEmptyLineBeforeComment",
+    CBoErrorType_EmptyLineBeforeComment,
+    0
+
+  },
+  [CBoRuleId_SeveralArgOnOneLine] = {
+
+    CBoFileCheckSeveralArgOnOneLine,
+    "CheckSeveralArgOnOneLine",
+    CBoErrorType_SeveralArgOnOneLine,
+    0
+
+  },
+  [CBoRuleId_AlignmentArg] = {
+
+    CBoFileCheckAlignmentArg,
+    "CBoFileCheckAlignmentArg",
+    CBoErrorType_ArgumentsUnaligned,
+    0
+
+  },
+  [CBoRuleId_EmptyLineBeforeCase] = {
+
+    CBoFileCheckEmptyLineBeforeCase,
+    "CheckEmptyLineBeforeCase",
+    CBoErrorType_EmptyLineBeforeCase,
+    0
+
+  },
+  [CBoRuleId_IndentLevel] = {
+
+    CBoFileCheckIndentLevel,
+    "CheckIndentLevel",
+    CBoErrorType_IndentLevel,
+    (1 << CBoRuleId_TrailingSpace) |
+    (1 << CBoRuleId_TabIndent) |
+    (1 << CBoRuleId_NoCurlyBraceAtHead) |
+    (1 << CBoRuleId_NoCurlyBraceAtTail)
+
+  },
+
+};
+
 // ================ Functions implementation ==================
 
 // Function to create a new CBo,
@@ -403,12 +2496,75 @@ CBo* CBoCreate(void) {
   that->files = GSetCreateStatic();
   that->filesWithError = GSetCreateStatic();
   that->flagListFileError = false;
-
-  // By default, set the output stream to stdout
+  that->flagFirstError = false;
+  that->nbMaxErrorPerFile = 0;
+
+  // By default, use one thread per available CPU
+  long nbCPU = sysconf(_SC_NPROCESSORS_ONLN);
+  that->nbThread = (nbCPU > 0 ? (unsigned int)nbCPU : 1);
+  that->timingsPath = NULL;
+  that->nbLineParallelRules = 0;
+  that->maxMemory = 0;
+  that->iShard = 0;
+  that->nbShard = 0;
+  that->shardPath = NULL;
+  that->nbPathAllShard = 0;
+  that->shardIndexes = NULL;
+  that->flagMerge = false;
+  that->flagReport = false;
+  that->nbMergedFile = 0;
+  that->nbMergedFileWithError = 0;
+  that->nbMergedError = 0;
+  that->flagInvalidResult = false;
+  that->socketPath = NULL;
+  that->flagWorker = false;
+  that->samplePercent = 0.0;
+  that->sampleSeed = 0;
+  that->nbStratum = 0;
+  that->stratumNbPath = NULL;
+  that->sampleStrata = NULL;
+  that->flagIsolate = false;
+  that->timeoutMs = 0;
+  that->progress = NULL;
+  that->format = CBoFormat_text;
+  that->flagResultWritten = false;
+  that->binaryPaths = GSetStrCreateStatic();
+  that->nbBinaryRecord = 0;
+  that->baselinePath = NULL;
+  that->flagUpdateBaseline = false;
+  that->baseline = NULL;
+  that->flagFix = false;
+  that->flagReindent = false;
+  that->flagFixDiff = false;
+  that->rangeFirstLine = 0;
+  that->rangeLastLine = 0;
+
+  // Create the error state of the CBo from the global one, to inherit
+  // its stream and fatality
+  that->err =
+    PBErrMalloc(
+      CBoErr,
+      sizeof(PBErr));
+  *(that->err) = *CBoErr;
+  that->lineMemo =
+    PBErrMalloc(
+      that->err,
+      sizeof(uint64_t) * 2 * CBO_LINE_MEMO_SIZE);
+  memset(
+    that->lineMemo,
+    0,
+    sizeof(uint64_t) * 2 * CBO_LINE_MEMO_SIZE);
+  that->ruleOrder = NULL;
+
+  // By default, set the output stream to stdout, colored only if it's
+  // a terminal
   that->stream =
     fopen(
       "/dev/stdout",
       "w");
+  that->flagColor =
+    (that->stream != NULL &&
+    isatty(fileno(that->stream)) != 0);
 
   // Return the new CBo
   return that;
@@ -424,8 +2580,22 @@ void CBoFree(CBo** const that) {
   fclose((*that)->stream);
 
   // Free memory used by properties
+  free((*that)->lineMemo);
+  free((*that)->ruleOrder);
+  free((*that)->err);
+  free((*that)->shardIndexes);
+  free((*that)->stratumNbPath);
+  free((*that)->sampleStrata);
+  CBoBaselineFree(&((*that)->baseline));
   GSetFlush(&((*that)->filePaths));
   GSetFlush(&((*that)->filesWithError));
+  while (GSetNbElem(&((*that)->binaryPaths)) > 0) {
+
+    char* path = GSetPop(&((*that)->binaryPaths));
+    free(path);
+
+  }
+
   while (GSetNbElem(&((*that)->files)) > 0) {
 
     CBoFile* file = GSetPop(&((*that)->files));
@@ -477,65 +2647,11924 @@ bool CBoProcessCmdLineArguments(
       printf("[-help] : print the help message\n");
       printf(
         "[-listFile] : print only the list of file(s) with error(s)\n");
+      printf(
+        "[--first-error] : stop at the first error\n");
+      printf(
+        "[--max-errors-per-file <n>] : stop checking a file after "
+        "<n> errors\n");
+      printf(
+        "[-j <n>] : check the files with <n> threads (default: one per "
+        "CPU)\n");
+      printf(
+        "[--timings <path>] : use and update the check time of files "
+        "recorded in <path>\n");
+      printf(
+        "[--parallel-rules <n>] : check the rules in parallel on files "
+        "of at least <n> lines\n");
+      printf(
+        "[--max-memory <n>[k|M|G]] : limit the memory used by the loaded "
+        "files\n");
+      printf(
+        "[--shard <i>/<n> <path>] : check only the shard <i> out of <n> "
+        "of the files and save its partial result in <path>\n");
+      printf(
+        "[--merge] : merge the partial results given as paths into one "
+        "report\n");
+      printf(
+        "[--coordinator <path>] : distribute the files to the worker "
+        "processes connecting on the socket <path>\n");
+      printf(
+        "[--worker <path>] : check the files distributed by the "
+        "coordinator on the socket <path>\n");
+      printf(
+        "[--sample <p>%%] : check only a sample of <p>%% of the files of "
+        "each directory and estimate the errors of all the files\n");
+      printf(
+        "[--seed <n>] : seed of the sample (default: 0)\n");
+      printf(
+        "[--format=<fmt>] : format of the output, text (default), "
+        "jsonl, sarif or binary\n");
+      printf(
+        "[--report] : render the binary results given as paths in the "
+        "format of the output\n");
+      printf(
+        "[--baseline <path>] : ignore the known errors recorded in the "
+        "baseline <path>\n");
+      printf(
+        "[--update-baseline] : record the errors of the check in the "
+        "baseline instead of ignoring them\n");
+      printf(
+        "[--isolate] : check each file in its own process, a file "
+        "crashing the check doesn't stop the check of the others\n");
+      printf(
+        "[--timeout <ms>] : abort the check of a file after <ms> "
+        "milliseconds, implies --isolate (default 60000)\n");
+      printf(
+        "[--fix] : fix in the files the errors of the mechanical "
+        "rules\n");
+      printf(
+        "[--reindent] : rewrite in the files the indentation of the "
+        "lines to their computed level\n");
+      printf(
+        "[--fix-diff] : display the fixes as a unified diff instead of "
+        "applying them\n");
+      printf(
+        "[--lines <a>:<b>] : check only the lines <a> to <b> of the "
+        "files\n");
       printf("\n");
 
     // Else, if the argument is -listFile
-    } else {
+    } else if (
+      strcmp(
+        argv[iArg],
+        "-listFile") == 0) {
 
-      unsigned int retStrCmp =
-        strcmp(
-          argv[iArg],
-          "-listFile");
-      if (retStrCmp == 0) {
+      // Update the flag
+      that->flagListFileError = true;
 
-        // Update the flag
-        that->flagListFileError = true;
+    // Else, if the argument is --first-error
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--first-error") == 0) {
 
-      // Else, any other arguments is considered to be a path
-      // to a file to check
-      } else {
+      // Update the flag
+      that->flagFirstError = true;
+
+    // Else, if the argument is --max-errors-per-file
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--max-errors-per-file") == 0) {
+
+      // Get the maximum number of errors from the next argument
+      char* endPtr = NULL;
+      long nbMaxError = 0;
+      if (iArg + 1 < argc) {
 
-        // Try to open the file to check the path
-        FILE* f =
-          fopen(
+        ++iArg;
+        nbMaxError =
+          strtol(
             argv[iArg],
-            "r");
+            &endPtr,
+            10);
+
+      }
 
-        // If the path is correct
-        if (f != NULL) {
+      // If the value is invalid
+      if (
+        endPtr == NULL ||
+        *endPtr != '\0' ||
+        nbMaxError <= 0) {
 
-          // Close the stream
-          fclose(f);
+        fprintf(
+          that->stream,
+          "--max-errors-per-file expects a positive integer\n");
+        return false;
 
-          // Add the path to the list of files to check
-          GSetAppend(
-            &(that->filePaths),
-            (char*)(argv[iArg]));
+      }
 
-        // Else the path is incorrect
-        } else {
+      // Update the maximum number of errors
+      that->nbMaxErrorPerFile = (unsigned int)nbMaxError;
+
+    // Else, if the argument is -j
+    } else if (
+      strcmp(
+        argv[iArg],
+        "-j") == 0) {
+
+      // Get the number of threads from the next argument
+      char* endPtr = NULL;
+      long nbThread = 0;
+      if (iArg + 1 < argc) {
+
+        ++iArg;
+        nbThread =
+          strtol(
+            argv[iArg],
+            &endPtr,
+            10);
+
+      }
+
+      // If the value is invalid
+      if (
+        endPtr == NULL ||
+        *endPtr != '\0' ||
+        nbThread <= 0) {
+
+        fprintf(
+          that->stream,
+          "-j expects a positive integer\n");
+        return false;
+
+      }
+
+      // Update the number of threads
+      that->nbThread = (unsigned int)nbThread;
+
+    // Else, if the argument is --timings
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--timings") == 0) {
+
+      // If the path is missing
+      if (iArg + 1 >= argc) {
+
+        fprintf(
+          that->stream,
+          "--timings expects a path\n");
+        return false;
+
+      }
+
+      // Memorize the path of the timings file, which may not exist
+      // yet
+      ++iArg;
+      that->timingsPath = argv[iArg];
+
+    // Else, if the argument is --parallel-rules
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--parallel-rules") == 0) {
+
+      // Get the number of lines from the next argument
+      char* endPtr = NULL;
+      long nbLine = 0;
+      if (iArg + 1 < argc) {
+
+        ++iArg;
+        nbLine =
+          strtol(
+            argv[iArg],
+            &endPtr,
+            10);
+
+      }
+
+      // If the value is invalid
+      if (
+        endPtr == NULL ||
+        *endPtr != '\0' ||
+        nbLine <= 0) {
+
+        fprintf(
+          that->stream,
+          "--parallel-rules expects a positive integer\n");
+        return false;
+
+      }
+
+      // Update the number of lines
+      that->nbLineParallelRules = (unsigned int)nbLine;
+
+    // Else, if the argument is --max-memory
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--max-memory") == 0) {
+
+      // Get the memory from the next argument
+      char* endPtr = NULL;
+      long long maxMemory = 0;
+      if (iArg + 1 < argc) {
+
+        ++iArg;
+        maxMemory =
+          strtoll(
+            argv[iArg],
+            &endPtr,
+            10);
+
+      }
+
+      // Apply the unit, if any
+      if (endPtr != NULL) {
+
+        if (*endPtr == 'k' || *endPtr == 'K') {
+
+          maxMemory *= 1024LL;
+          ++endPtr;
+
+        } else if (*endPtr == 'm' || *endPtr == 'M') {
+
+          maxMemory *= 1024LL * 1024LL;
+          ++endPtr;
+
+        } else if (*endPtr == 'g' || *endPtr == 'G') {
+
+          maxMemory *= 1024LL * 1024LL * 1024LL;
+          ++endPtr;
+
+        }
+
+      }
+
+      // If the value is invalid
+      if (
+        endPtr == NULL ||
+        *endPtr != '\0' ||
+        maxMemory <= 0) {
+
+        fprintf(
+          that->stream,
+          "--max-memory expects a positive size\n");
+        return false;
+
+      }
+
+      // Update the maximum memory
+      that->maxMemory = (size_t)maxMemory;
+
+    // Else, if the argument is --shard
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--shard") == 0) {
+
+      // Get the shard and the number of shards from the next argument,
+      // and the path of the partial result from the one after
+      char* endPtr = NULL;
+      long iShard = 0;
+      long nbShard = 0;
+      if (iArg + 2 < argc) {
+
+        ++iArg;
+        iShard =
+          strtol(
+            argv[iArg],
+            &endPtr,
+            10);
+        if (*endPtr == '/') {
+
+          nbShard =
+            strtol(
+              endPtr + 1,
+              &endPtr,
+              10);
+
+        }
+
+      }
+
+      // If the value is invalid
+      if (
+        endPtr == NULL ||
+        *endPtr != '\0' ||
+        iShard <= 0 ||
+        nbShard < iShard) {
+
+        fprintf(
+          that->stream,
+          "--shard expects <i>/<n> with 0<i<=n and a path\n");
+        return false;
+
+      }
+
+      // Update the shard
+      that->iShard = (unsigned int)iShard;
+      that->nbShard = (unsigned int)nbShard;
+      ++iArg;
+      that->shardPath = argv[iArg];
+
+    // Else, if the argument is --coordinator or --worker
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--coordinator") == 0 ||
+      strcmp(
+        argv[iArg],
+        "--worker") == 0) {
+
+      // If the path is missing
+      if (iArg + 1 >= argc) {
+
+        fprintf(
+          that->stream,
+          "%s expects a path\n",
+          argv[iArg]);
+        return false;
+
+      }
+
+      // Memorize the role and the path of the socket
+      that->flagWorker =
+        (strcmp(
+          argv[iArg],
+          "--worker") == 0);
+      ++iArg;
+      that->socketPath = argv[iArg];
+
+    // Else, if the argument is --sample
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--sample") == 0) {
+
+      // Get the percentage from the next argument, the '%' is optional
+      char* endPtr = NULL;
+      double percent = 0.0;
+      if (iArg + 1 < argc) {
+
+        ++iArg;
+        percent =
+          strtod(
+            argv[iArg],
+            &endPtr);
+        if (endPtr != NULL && *endPtr == '%') {
+
+          ++endPtr;
+
+        }
+
+      }
+
+      // If the value is invalid
+      if (
+        endPtr == NULL ||
+        *endPtr != '\0' ||
+        percent <= 0.0 ||
+        percent > 100.0) {
+
+        fprintf(
+          that->stream,
+          "--sample expects a percentage in ]0, 100]\n");
+        return false;
+
+      }
+
+      // Update the percentage
+      that->samplePercent = percent;
+
+    // Else, if the argument is --seed
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--seed") == 0) {
+
+      // Get the seed from the next argument
+      char* endPtr = NULL;
+      unsigned long seed = 0;
+      if (iArg + 1 < argc) {
+
+        ++iArg;
+        seed =
+          strtoul(
+            argv[iArg],
+            &endPtr,
+            10);
+
+      }
+
+      // If the value is invalid
+      if (
+        endPtr == NULL ||
+        *endPtr != '\0') {
+
+        fprintf(
+          that->stream,
+          "--seed expects a positive integer\n");
+        return false;
+
+      }
+
+      // Update the seed
+      that->sampleSeed = (unsigned int)seed;
+
+    // Else, if the argument is --format=<fmt>
+    } else if (
+      strncmp(
+        argv[iArg],
+        "--format=",
+        9) == 0) {
+
+      // Get the format
+      const char* format = argv[iArg] + 9;
+      if (
+        strcmp(
+          format,
+          "text") == 0) {
+
+        that->format = CBoFormat_text;
+
+      } else if (
+        strcmp(
+          format,
+          "jsonl") == 0) {
+
+        that->format = CBoFormat_jsonl;
+
+      } else if (
+        strcmp(
+          format,
+          "sarif") == 0) {
+
+        that->format = CBoFormat_sarif;
+
+      } else if (
+        strcmp(
+          format,
+          "binary") == 0) {
+
+        that->format = CBoFormat_binary;
+
+      } else {
+
+        fprintf(
+          that->stream,
+          "--format expects text, jsonl, sarif or binary\n");
+        return false;
+
+      }
+
+    // Else, if the argument is --baseline
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--baseline") == 0) {
+
+      // If the path is missing
+      if (iArg + 1 >= argc) {
+
+        fprintf(
+          that->stream,
+          "--baseline expects a path\n");
+        return false;
+
+      }
+
+      // Memorize the path of the baseline
+      ++iArg;
+      that->baselinePath = argv[iArg];
+
+    // Else, if the argument is --update-baseline
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--update-baseline") == 0) {
+
+      // Update the flag
+      that->flagUpdateBaseline = true;
+
+    // Else, if the argument is --isolate
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--isolate") == 0) {
+
+      // Update the flag
+      that->flagIsolate = true;
+
+    // Else, if the argument is --timeout
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--timeout") == 0) {
+
+      // Get the time budget from the next argument
+      char* endPtr = NULL;
+      unsigned long timeout = 0;
+      if (iArg + 1 < argc) {
+
+        ++iArg;
+        timeout =
+          strtoul(
+            argv[iArg],
+            &endPtr,
+            10);
+
+      }
+
+      // If the value is invalid
+      if (
+        endPtr == NULL ||
+        *endPtr != '\0' ||
+        timeout == 0 ||
+        timeout > UINT_MAX) {
+
+        fprintf(
+          that->stream,
+          "--timeout expects a strictly positive number of "
+          "milliseconds\n");
+        return false;
+
+      }
+
+      // Update the time budget, the files can be aborted only in
+      // isolation
+      that->timeoutMs = (unsigned int)timeout;
+      that->flagIsolate = true;
+
+    // Else, if the argument is --merge
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--merge") == 0) {
+
+      // Update the flag
+      that->flagMerge = true;
+
+    // Else, if the argument is --report
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--report") == 0) {
+
+      // Update the flag
+      that->flagReport = true;
+
+    // Else, if the argument is --fix
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--fix") == 0) {
+
+      // Update the flag
+      that->flagFix = true;
+
+    // Else, if the argument is --reindent
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--reindent") == 0) {
+
+      // Update the flag
+      that->flagReindent = true;
+
+    // Else, if the argument is --fix-diff
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--fix-diff") == 0) {
+
+      // Update the flags, the errors are fixed but only the diff of the
+      // fixes is displayed
+      that->flagFix = true;
+      that->flagFixDiff = true;
+
+    // Else, if the argument is --lines
+    } else if (
+      strcmp(
+        argv[iArg],
+        "--lines") == 0) {
+
+      // Get the first and last lines from the next argument
+      char* endPtr = NULL;
+      long firstLine = 0;
+      long lastLine = 0;
+      if (iArg + 1 < argc) {
+
+        ++iArg;
+        firstLine =
+          strtol(
+            argv[iArg],
+            &endPtr,
+            10);
+        if (*endPtr == ':') {
+
+          lastLine =
+            strtol(
+              endPtr + 1,
+              &endPtr,
+              10);
+
+        }
+
+      }
+
+      // If the value is invalid
+      if (
+        endPtr == NULL ||
+        *endPtr != '\0' ||
+        firstLine <= 0 ||
+        lastLine < firstLine) {
+
+        fprintf(
+          that->stream,
+          "--lines expects <a>:<b> with 0<a<=b\n");
+        return false;
+
+      }
+
+      // Update the range of lines
+      that->rangeFirstLine = (unsigned int)firstLine;
+      that->rangeLastLine = (unsigned int)lastLine;
+
+    // Else, any other arguments is considered to be a path
+    // to a file to check
+    } else {
+
+      // Try to open the file to check the path
+      FILE* f =
+        fopen(
+          argv[iArg],
+          "r");
+
+      // If the path is correct
+      if (f != NULL) {
+
+        // Close the stream
+        fclose(f);
+
+        // Add the path to the list of files to check
+        GSetAppend(
+          &(that->filePaths),
+          (char*)(argv[iArg]));
+
+      // Else the path is incorrect
+      } else {
+
+        fprintf(
+          that->stream,
+          "The path [%s] is incorrect\n",
+          argv[iArg]);
+        return false;
+
+      }
+
+    }
+
+  }
+
+  // The files distributed to worker processes are not sharded nor
+  // merged
+  if (
+    that->socketPath != NULL &&
+    (that->nbShard > 0 || that->flagMerge == true)) {
+
+    fprintf(
+      that->stream,
+      "--coordinator and --worker can't be used with --shard or "
+      "--merge\n");
+    return false;
+
+  }
+
+  // The list of files with errors is only in text format
+  if (
+    that->format != CBoFormat_text &&
+    that->flagListFileError == true) {
+
+    fprintf(
+      that->stream,
+      "--format can't be used with -listFile\n");
+    return false;
+
+  }
+
+  // The binary results are rendered as they are
+  if (
+    that->flagReport == true &&
+    (that->flagListFileError == true ||
+    that->nbShard > 0 ||
+    that->flagMerge == true ||
+    that->socketPath != NULL ||
+    that->samplePercent > 0.0)) {
+
+    fprintf(
+      that->stream,
+      "--report can't be used with -listFile, --shard, --merge, "
+      "--coordinator, --worker or --sample\n");
+    return false;
+
+  }
+
+  // The estimation from the sample needs all the sampled files
+  if (
+    that->samplePercent > 0.0 &&
+    (that->nbShard > 0 ||
+    that->flagMerge == true ||
+    that->socketPath != NULL)) {
+
+    fprintf(
+      that->stream,
+      "--sample can't be used with --shard, --merge, --coordinator or "
+      "--worker\n");
+    return false;
+
+  }
+
+  // The baseline is applied by the processes checking the files
+  if (
+    that->baselinePath != NULL &&
+    (that->flagMerge == true ||
+    that->flagReport == true ||
+    (that->socketPath != NULL && that->flagWorker == false))) {
+
+    fprintf(
+      that->stream,
+      "--baseline can't be used with --merge, --report or "
+      "--coordinator, give it to the shards or the workers\n");
+    return false;
+
+  }
+
+  // The baseline is updated with all the errors of all the files
+  if (
+    that->flagUpdateBaseline == true &&
+    (that->baselinePath == NULL ||
+    that->flagListFileError == true ||
+    that->flagFirstError == true ||
+    that->nbMaxErrorPerFile > 0 ||
+    that->nbShard > 0 ||
+    that->socketPath != NULL ||
+    that->samplePercent > 0.0)) {
+
+    fprintf(
+      that->stream,
+      "--update-baseline needs --baseline and can't be used with "
+      "-listFile, --first-error, --max-errors-per-file, --shard, "
+      "--coordinator, --worker or --sample\n");
+    return false;
+
+  }
+
+  // The files are fixed by the processes checking them, and not in
+  // isolation as the errors of the child process must match the lines
+  // of the file
+  if (
+    (that->flagFix == true || that->flagReindent == true) &&
+    (that->flagMerge == true ||
+    that->flagReport == true ||
+    that->flagIsolate == true ||
+    (that->socketPath != NULL && that->flagWorker == false))) {
+
+    fprintf(
+      that->stream,
+      "--fix, --reindent and --fix-diff can't be used with --merge, "
+      "--report, --isolate, --timeout or --coordinator, give them to "
+      "the workers\n");
+    return false;
+
+  }
+
+  // The range of lines is checked by the process which loaded the
+  // file, and the fixes and the baseline apply to whole files
+  if (
+    that->rangeFirstLine > 0 &&
+    (that->flagFix == true ||
+    that->flagReindent == true ||
+    that->flagMerge == true ||
+    that->flagReport == true ||
+    that->flagIsolate == true ||
+    that->flagUpdateBaseline == true ||
+    that->socketPath != NULL)) {
+
+    fprintf(
+      that->stream,
+      "--lines can't be used with --fix, --reindent, --fix-diff, "
+      "--merge, --report, --isolate, --timeout, --coordinator, --worker "
+      "or --update-baseline\n");
+    return false;
+
+  }
+
+  // The diff of the fixes is the only output
+  if (
+    that->flagFixDiff == true &&
+    (that->format != CBoFormat_text ||
+    that->flagListFileError == true)) {
+
+    fprintf(
+      that->stream,
+      "--fix-diff can't be used with --format or -listFile\n");
+    return false;
+
+  }
+
+  // If the baseline is applied, load it
+  if (
+    that->baselinePath != NULL &&
+    that->flagUpdateBaseline == false &&
+    CBoBaselineLoad(that) == false) {
+
+    return false;
+
+  }
+
+  // If the files are sampled, keep only the sampled files
+  if (that->samplePercent > 0.0) {
+
+    CBoSelectSamplePaths(that);
+
+  }
+
+  // If the files are sharded
+  if (that->nbShard > 0) {
+
+    // The partial results are merged from unsharded runs
+    if (that->flagMerge == true) {
+
+      fprintf(
+        that->stream,
+        "--shard and --merge can't be used together\n");
+      return false;
+
+    }
+
+    // Keep only the files of the shard
+    CBoSelectShardPaths(that);
+
+  }
+
+  // Return the successfull code
+  return true;
+
+}
+
+// Function to get the number of file with error in the CBo 'that'
+unsigned int CBoGetNbFilesWithError(const CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  return
+    GSetNbElem(&(that->filesWithError)) +
+    that->nbMergedFileWithError;
+
+}
+
+// Function to get the total number of errors in the CBo 'that'
+unsigned int CBoGetNbErrors(const CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the number of errors, starting
+  // with the ones of the merged partial results
+  unsigned int nb = that->nbMergedError;
+
+  // If there is files with error. Only the files with errors reported
+  // are counted, the ones checked after the first error when the user
+  // requested to stop at the first error are ignored
+  if (GSetNbElem(&(that->filesWithError)) > 0) {
+
+    // Loop on files with error
+    GSetIterForward iter =
+      GSetIterForwardCreateStatic(&(that->filesWithError));
+    do {
+
+      // Get the file
+      CBoFile* file = GSetIterGet(&iter);
+
+      // Add the number of errors on this file
+      nb += CBoFileGetNbError(file);
+
+    } while(GSetIterStep(&iter));
+
+  }
+
+  // Return the number of errors
+  return nb;
+
+}
+
+// Check the files of the CBo 'that'
+// Return true if there was no problem, else false
+bool CBoCheckAllFiles(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Reset the set of files with error
+  GSetFlush(&(that->filesWithError));
+
+  // Calculate the order of check of the rules, once for all the files
+  if (that->ruleOrder == NULL) {
+
+    that->ruleOrder =
+      PBErrMalloc(
+        that->err,
+        sizeof(unsigned int) * CBoRuleId_nb);
+    CBoRuleGetSchedule(
+      cboRules,
+      that->ruleOrder);
+
+  }
+
+  // If the paths are partial results, merge them instead of checking
+  // files, the merge prints the head of the SARIF document once it
+  // knows the format of the partial results
+  bool success = true;
+  if (that->flagMerge == true) {
+
+    success = CBoMergePartialResults(that);
+
+  // Else, if the paths are binary results, render them
+  } else if (that->flagReport == true) {
+
+    CBoPrintOutputHead(that);
+    success = CBoRenderBinaryResults(that);
+
+  // Else, if the files are checked by this process as a worker, its
+  // reports are sent to the coordinator
+  } else if (
+    that->socketPath != NULL &&
+    that->flagWorker == true) {
+
+    return CBoWork(that);
+
+  // Else, the files are checked or distributed by this process
+  } else {
+
+    // If the files are sharded, create the partial result of the shard
+    FILE* partial = NULL;
+    if (that->nbShard > 0) {
+
+      partial =
+        fopen(
+          that->shardPath,
+          "w");
+      if (partial == NULL) {
+
+        fprintf(
+          that->stream,
+          "Failed to save the partial result in [%s]\n",
+          that->shardPath);
+        return false;
+
+      }
+
+      // Save the header of the partial result, with what is needed to
+      // check the set of partial results is complete and to merge them
+      fprintf(
+        partial,
+        "CBoPartial %u/%u %u %d %d %d\n",
+        that->iShard,
+        that->nbShard,
+        that->nbPathAllShard,
+        that->flagListFileError,
+        that->flagFirstError,
+        that->format);
+
+    }
+
+    // Print the head of the output
+    CBoPrintOutputHead(that);
+
+    // If the files are distributed to worker processes, distribute
+    // them as the coordinator, else check them
+    if (that->socketPath != NULL) {
+
+      success = CBoCoordinate(that);
+
+    } else {
+
+      success =
+        CBoCheckFiles(
+          that,
+          partial);
+
+    }
+
+    // If the files are sampled, display the estimation of the errors of
+    // all the files, unless we display only the list of files with
+    // errors or the diff of the fixes, or the output is for a machine
+    if (
+      that->samplePercent > 0.0 &&
+      that->flagListFileError == false &&
+      that->flagFixDiff == false &&
+      that->format == CBoFormat_text) {
+
+      CBoPrintSampleEstimate(that);
+
+    }
+
+    // Close the partial result
+    if (partial != NULL) {
+
+      fclose(partial);
+
+    }
+
+  }
+
+  // Print the tail of the output
+  CBoPrintOutputTail(that);
+
+  // Return the success flag
+  return success;
+
+}
+
+// Check the files of the CBo 'that' with the pipeline and display
+// their reports. If 'partial' is not NULL, also save the reports in it
+// Return true if all the files were loaded and correct, else false
+bool CBoCheckFiles(
+   CBo* const that,
+  FILE* const partial) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize if all the file were loaded
+  bool allLoaded = true;
+
+  // Declare a variable to memorize if all the file were correct
+  bool allCorrect = true;
+
+  // The new baseline replaces the current one, so it must have all the
+  // errors of all the files. Refuse the options stopping the check or
+  // the errors of a file early, even if they were set after the
+  // arguments were processed, else the files after the first error
+  // would be dropped from the baseline
+  if (
+    that->flagUpdateBaseline == true &&
+    (that->flagFirstError == true ||
+    that->flagListFileError == true ||
+    that->nbMaxErrorPerFile > 0)) {
+
+    fprintf(
+      that->stream,
+      "--update-baseline can't be used with -listFile, --first-error "
+      "or --max-errors-per-file\n");
+    return false;
+
+  }
+
+  // If the baseline is updated, open the new baseline, which replaces
+  // the current one only once complete
+  FILE* newBaseline = NULL;
+  char* newBaselinePath = NULL;
+  if (that->flagUpdateBaseline == true) {
+
+    newBaselinePath =
+      PBErrMalloc(
+        that->err,
+        strlen(that->baselinePath) + 5);
+    sprintf(
+      newBaselinePath,
+      "%s.tmp",
+      that->baselinePath);
+    newBaseline =
+      fopen(
+        newBaselinePath,
+        "w");
+    if (newBaseline == NULL) {
+
+      fprintf(
+        that->stream,
+        "Failed to save the baseline in [%s]\n",
+        that->baselinePath);
+      free(newBaselinePath);
+      return false;
+
+    }
+
+    fprintf(
+      newBaseline,
+      "CBoBaseline %d\n",
+      CBO_BASELINE_VERSION);
+
+  }
+
+  // If there are files to check
+  if (CBoGetNbFiles(that) > 0) {
+
+    // Get the number of threads checking the files, no more than the
+    // number of files, and the number of threads loading them, loading
+    // is faster than checking so one loader per four checkers is
+    // enough
+    unsigned int nbChecker = that->nbThread;
+    if (nbChecker > (unsigned int)CBoGetNbFiles(that)) {
+
+      nbChecker = CBoGetNbFiles(that);
+
+    }
+
+    unsigned int nbLoader = (nbChecker + 3) / 4;
+
+    // Create the progress reporter, before the pipeline copies the CBo
+    that->progress =
+      CBoProgressCreate(
+        that,
+        CBoGetNbFiles(that));
+
+    // Create the pipeline
+    CBoPipeline pipeline;
+    CBoPipelineInit(
+      &pipeline,
+      that,
+      nbChecker);
+
+    // Start the threads loading and checking the files
+    pthread_t* threads =
+      PBErrMalloc(
+        that->err,
+        sizeof(pthread_t) * (nbLoader + nbChecker));
+    unsigned int nbStartedLoader = 0;
+    unsigned int nbStartedChecker = 0;
+    for (
+      unsigned int iThread = 0;
+      iThread < nbLoader + nbChecker;
+      ++iThread) {
+
+      // The first threads are the loaders
+      bool isLoader = (iThread < nbLoader);
+      int ret =
+        pthread_create(
+          threads + nbStartedLoader + nbStartedChecker,
+          NULL,
+          (isLoader == true ? CBoLoadWorker : CBoCheckWorker),
+          &pipeline);
+      if (ret == 0 && isLoader == true) {
+
+        ++nbStartedLoader;
+
+      } else if (ret == 0) {
+
+        ++nbStartedChecker;
+
+      }
+
+    }
+
+    // If a stage has no thread, load and check the files in the
+    // current thread
+    if (
+      nbStartedLoader == 0 ||
+      nbStartedChecker == 0) {
+
+      // Stop the threads already started before they pick a file
+      pthread_mutex_lock(&(pipeline.mutex));
+      pipeline.flagStop = true;
+      pthread_cond_broadcast(&(pipeline.condQueued));
+      pthread_cond_broadcast(&(pipeline.condSpace));
+      pthread_mutex_unlock(&(pipeline.mutex));
+      for (
+        unsigned int iThread = 0;
+        iThread < nbStartedLoader + nbStartedChecker;
+        ++iThread) {
+
+        pthread_join(
+          threads[iThread],
+          NULL);
+
+      }
+
+      nbStartedLoader = 0;
+      nbStartedChecker = 0;
+
+      // Without memory budget, all the files can be loaded, then checked
+      pipeline.flagStop = false;
+      pipeline.maxMemory = 0;
+      pipeline.nbMaxQueued = pipeline.nbFile;
+      CBoLoadWorker(&pipeline);
+      CBoCheckWorker(&pipeline);
+
+    }
+
+    // Loop on the files in the order of the arguments, to get an output
+    // identical whatever the number of threads
+    for (
+      unsigned int iFile = 0;
+      iFile < pipeline.nbFile &&
+      (that->flagFirstError == false || allCorrect == true);
+      ++iFile) {
+
+      // Wait for the end of the load or the check of the file. If the
+      // progress is displayed, wake up regularly to display it
+      pthread_mutex_lock(&(pipeline.mutex));
+      while (
+        pipeline.isLoadFailed[iFile] == false &&
+        (pipeline.files[iFile] == NULL ||
+        pipeline.files[iFile]->isChecked == false)) {
+
+        if (that->progress != NULL) {
+
+          pthread_mutex_unlock(&(pipeline.mutex));
+          CBoProgressDraw(that->progress);
+          struct timespec time;
+          CBoGetWaitTime(
+            &time,
+            CBO_PROGRESS_DELAY_MS,
+            NULL);
+          pthread_mutex_lock(&(pipeline.mutex));
+          pthread_cond_timedwait(
+            &(pipeline.condDone),
+            &(pipeline.mutex),
+            &time);
+
+        } else {
+
+          pthread_cond_wait(
+            &(pipeline.condDone),
+            &(pipeline.mutex));
+
+        }
+
+      }
+
+      pthread_mutex_unlock(&(pipeline.mutex));
+
+      // Erase the progress before displaying the report
+      if (that->progress != NULL) {
+
+        CBoProgressClear(that->progress);
+
+      }
+
+      // Get the file
+      CBoFile* file = pipeline.files[iFile];
+
+      // Display the report of the file, and save it in the partial
+      // result if the files are sharded
+      CBoEmitFileReport(
+        that,
+        pipeline.paths[iFile],
+        file,
+        (partial != NULL ? that->shardIndexes[iFile] : iFile),
+        partial);
+
+      // If we couldn't load the file, update the flag
+      if (file == NULL) {
+
+        allLoaded = false;
+
+      }
+
+      // If the file was loaded
+      if (file != NULL) {
+
+        // If the baseline is updated, save the errors of the file in
+        // the new baseline, while its lines are available
+        if (newBaseline != NULL) {
+
+          CBoFileSaveBaseline(
+            file,
+            newBaseline);
+
+        }
+
+        // Free the output of the check of the file, and its lines
+        // which are not needed anymore
+        free(file->output);
+        file->output = NULL;
+        file->outputSize = 0;
+        CBoFileFreeLines(file);
+
+        // If the file has error(s), add it to the list of files with
+        // errors
+        if (file->isCorrect == false) {
+
+          GSetAppend(
+            &(that->filesWithError),
+            file);
+
+        }
+
+        // Update the global flag
+        allCorrect &= file->isCorrect;
+
+      }
+
+      // Release the memory of the file and move to the next file
+      pthread_mutex_lock(&(pipeline.mutex));
+      if (pipeline.isPicked[iFile] == true) {
+
+        pipeline.memory -= pipeline.sizes[iFile];
+
+      }
+
+      pipeline.iEmit = iFile + 1;
+      pthread_cond_broadcast(&(pipeline.condSpace));
+      pthread_mutex_unlock(&(pipeline.mutex));
+
+    }
+
+    // Stop the threads, in case we stopped at the first error, and wait
+    // for them to end
+    pthread_mutex_lock(&(pipeline.mutex));
+    pipeline.flagStop = true;
+    pthread_cond_broadcast(&(pipeline.condQueued));
+    pthread_cond_broadcast(&(pipeline.condSpace));
+    pthread_mutex_unlock(&(pipeline.mutex));
+    for (
+      unsigned int iThread = 0;
+      iThread < nbStartedLoader + nbStartedChecker;
+      ++iThread) {
+
+      pthread_join(
+        threads[iThread],
+        NULL);
+
+    }
+
+    // Add the loaded files to the list of files, in the order of the
+    // arguments, and free the output of the files checked but not
+    // displayed
+    for (
+      unsigned int iFile = 0;
+      iFile < pipeline.nbFile;
+      ++iFile) {
+
+      CBoFile* file = pipeline.files[iFile];
+      if (file != NULL) {
+
+        free(file->output);
+        file->output = NULL;
+        file->outputSize = 0;
+        GSetAppend(
+          &(that->files),
+          file);
+
+      }
+
+    }
+
+    // Erase and free the progress reporter
+    if (that->progress != NULL) {
+
+      CBoProgressClear(that->progress);
+
+    }
+
+    CBoProgressFree(&(that->progress));
+
+    // Save the check time of the files for the next run
+    CBoSaveTimings(that);
+
+    // Free the memory used by the pipeline and the threads
+    CBoPipelineFree(&pipeline);
+    free(threads);
+
+  }
+
+  // If the baseline is updated, replace the current one with the new
+  // one
+  if (newBaseline != NULL) {
+
+    bool isSaved = (fclose(newBaseline) == 0);
+    if (isSaved == true) {
+
+      isSaved =
+        (rename(
+          newBaselinePath,
+          that->baselinePath) == 0);
+
+    }
+
+    if (isSaved == false) {
+
+      fprintf(
+        that->stream,
+        "Failed to save the baseline in [%s]\n",
+        that->baselinePath);
+      allLoaded = false;
+
+    }
+
+    free(newBaselinePath);
+
+  }
+
+  // Return the success flag
+  return allLoaded & allCorrect;
+
+}
+
+// Main function of the threads loading the files: pick the files
+// from the CBoPipeline 'arg' until there is no more file, load them
+// and queue them for the checker threads
+// Return NULL
+void* CBoLoadWorker(void* arg) {
+
+#if BUILDMODE == 0
+  if (arg == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'arg' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the pipeline
+  CBoPipeline* pipeline = (CBoPipeline*)arg;
+
+  // Loop on the files to load
+  pthread_mutex_lock(&(pipeline->mutex));
+  unsigned int iPath = 0;
+  while (
+    CBoPipelinePickPath(
+      pipeline,
+      &iPath) == true) {
+
+    // Load the file, without holding the mutex
+    pthread_mutex_unlock(&(pipeline->mutex));
+    CBoFile* file =
+      CBoFileCreate(
+        pipeline->paths[iPath],
+        &(pipeline->cbo));
+    pthread_mutex_lock(&(pipeline->mutex));
+
+    // If we could load the file
+    if (file != NULL) {
+
+      // Queue the file for the checker threads
+      pipeline->files[iPath] = file;
+      CBoPipelinePushFile(
+        pipeline,
+        file);
+
+    // Else, we couldn't load the file
+    } else {
+
+      // Update the flag, and signal it to the current thread
+      pipeline->isLoadFailed[iPath] = true;
+      pthread_cond_broadcast(&(pipeline->condDone));
+
+    }
+
+    // If it was the last file, signal it to the checker threads
+    ++(pipeline->nbLoaded);
+    if (pipeline->nbLoaded == pipeline->nbFile) {
+
+      pthread_cond_broadcast(&(pipeline->condQueued));
+
+    }
+
+  }
+
+  pthread_mutex_unlock(&(pipeline->mutex));
+
+  // Return NULL
+  return NULL;
+
+}
+
+// Main function of the threads checking the files: pick the files
+// from the CBoPipeline 'arg' until there is no more file, check
+// them and memorize their output
+// Return NULL
+void* CBoCheckWorker(void* arg) {
+
+#if BUILDMODE == 0
+  if (arg == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'arg' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the pipeline
+  CBoPipeline* pipeline = (CBoPipeline*)arg;
+
+  // Create a copy of the CBo for this thread, sharing the options and
+  // the memoization table, to give it its own output stream
+  CBo cbo = pipeline->cbo;
+
+  // Get the index of the deque owned by this thread, if the check is
+  // done in the calling thread because no thread could be started it
+  // gets the first deque
+  unsigned int iDeque =
+    __atomic_fetch_add(
+      &(pipeline->iNextDeque),
+      1,
+      __ATOMIC_RELAXED);
+  if (iDeque >= pipeline->nbDeque) {
+
+    iDeque = 0;
+
+  }
+
+  // If the files are checked in isolation, create the ring receiving
+  // the results of the child processes of this thread
+  CBoIsolateRing* ring = NULL;
+  if (cbo.flagIsolate == true) {
+
+    ring = CBoIsolateRingCreate(&cbo);
+
+  }
+
+  // Pick the first file
+  pthread_mutex_lock(&(pipeline->mutex));
+  CBoFile* file =
+    CBoPipelinePickFile(
+      pipeline,
+      iDeque);
+  pthread_mutex_unlock(&(pipeline->mutex));
+
+  // Loop until there is no more file or the threads are stopped
+  while (file != NULL) {
+
+    // Get the start time of the check
+    struct timespec start;
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &start);
+
+    // Report the start of the check of the file, if the progress is
+    // displayed
+    if (cbo.progress != NULL) {
+
+      CBoProgressSetFile(
+        cbo.progress,
+        file->filePath);
+
+    }
+
+    // Open a stream on the output buffer of the file if the output of
+    // the check is displayed, else check the file with a null stream
+    // so the rules don't format an output nobody will see
+    cbo.stream = NULL;
+    if (
+      cbo.format == CBoFormat_text &&
+      cbo.flagListFileError == false) {
+
+      cbo.stream =
+        open_memstream(
+          &(file->output),
+          &(file->outputSize));
+      if (cbo.stream == NULL) {
+
+        cbo.err->_type = PBErrTypeIOError;
+        sprintf(
+          cbo.err->_msg,
+          "Failed to open the output stream of [%s]",
+          file->filePath);
+        PBErrCatch(cbo.err);
+
+      }
+
+    }
+
+    // If the files are checked in isolation
+    bool correct = true;
+    if (ring != NULL) {
+
+      // Check the file in a child process, which displays its errors
+      correct =
+        CBoFileCheckIsolated(
+          file,
+          &cbo,
+          ring);
+
+    // Else, check the file in this thread
+    } else {
+
+      correct =
+        CBoFileCheck(
+          file,
+          &cbo);
+
+      // If the file has error(s) and we don't display only the list of
+      // files with errors or the diff of the fixes, display the errors
+      // of the file
+      if (
+        correct == false &&
+        cbo.flagListFileError == false &&
+        cbo.flagFixDiff == false &&
+        cbo.format == CBoFormat_text) {
+
+        CBoFilePrintErrors(
+          file,
+          &cbo);
+
+      }
+
+    }
+
+    // Close the stream, which updates the output buffer of the file
+    if (cbo.stream != NULL) {
+
+      fclose(cbo.stream);
+
+    }
+
+    // If the output is made of records, print the records of the file
+    // in its output buffer
+    if (cbo.format != CBoFormat_text) {
+
+      cbo.stream =
+        open_memstream(
+          &(file->output),
+          &(file->outputSize));
+      if (cbo.stream == NULL) {
+
+        cbo.err->_type = PBErrTypeIOError;
+        sprintf(
+          cbo.err->_msg,
+          "Failed to open the output stream of [%s]",
+          file->filePath);
+        PBErrCatch(cbo.err);
+
+      }
+
+      CBoFilePrintRecords(
+        file,
+        &cbo);
+      fclose(cbo.stream);
+
+    }
+
+    // Memorize the check time of the file
+    struct timespec end;
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &end);
+    file->checkTime =
+      (double)(end.tv_sec - start.tv_sec) +
+      (double)(end.tv_nsec - start.tv_nsec) * 1e-9;
+
+    // Report the end of the check of the file, if the progress is
+    // displayed
+    if (cbo.progress != NULL) {
+
+      CBoProgressEndFile(cbo.progress);
+
+    }
+
+    // Signal the end of the check of the file, and pick the next file
+    pthread_mutex_lock(&(pipeline->mutex));
+    file->isCorrect = correct;
+    file->isChecked = true;
+    pthread_cond_broadcast(&(pipeline->condDone));
+    file =
+      CBoPipelinePickFile(
+        pipeline,
+        iDeque);
+    pthread_mutex_unlock(&(pipeline->mutex));
+
+  }
+
+  // Free the ring
+  CBoIsolateRingFree(&ring);
+
+  // Return NULL
+  return NULL;
+
+}
+
+// Check all the rules on the CBoFile 'that' with the CBo 'cbo' in
+// parallel, each rule on its own copy of the file
+// Return the array of the results, indexed by rule identifier
+CBoRuleRun* CBoFileRunRulesParallel(
+  CBoFile* const that,
+      CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Create the runs. The file is read only during the check of the
+  // rules, so the copies can share its lines, only the errors and the
+  // output stream need to be separated
+  CBoRuleRunQueue queue;
+  queue.runs =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(CBoRuleRun) * CBoRuleId_nb);
+  queue.iNextRule = 0;
+  for (
+    unsigned int iRule = 0;
+    iRule < CBoRuleId_nb;
+    ++iRule) {
+
+    CBoRuleRun* run = queue.runs + iRule;
+    run->file = *that;
+    run->file.errors = GSetCreateStatic();
+    run->cbo = *cbo;
+    run->output = NULL;
+    run->outputSize = 0;
+    run->success = true;
+
+  }
+
+  // Start the threads checking the rules, no more than the number of
+  // rules
+  unsigned int nbThread = cbo->nbThread;
+  if (nbThread > CBoRuleId_nb) {
+
+    nbThread = CBoRuleId_nb;
+
+  }
+
+  pthread_t threads[CBoRuleId_nb];
+  unsigned int nbStartedThread = 0;
+  for (
+    unsigned int iThread = 0;
+    iThread < nbThread;
+    ++iThread) {
+
+    int ret =
+      pthread_create(
+        threads + nbStartedThread,
+        NULL,
+        CBoRuleWorker,
+        &queue);
+    if (ret == 0) {
+
+      ++nbStartedThread;
+
+    }
+
+  }
+
+  // Check the rules in the current thread too, which also ensures they
+  // are checked if no thread could be started
+  CBoRuleWorker(&queue);
+
+  // Wait for the threads to end
+  for (
+    unsigned int iThread = 0;
+    iThread < nbStartedThread;
+    ++iThread) {
+
+    pthread_join(
+      threads[iThread],
+      NULL);
+
+  }
+
+  // Return the runs
+  return queue.runs;
+
+}
+
+// Main function of the threads checking the rules of one file in
+// parallel: pick the rules from the CBoRuleRunQueue 'arg' until there
+// is no more rule and check them
+// Return NULL
+void* CBoRuleWorker(void* arg) {
+
+#if BUILDMODE == 0
+  if (arg == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'arg' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the queue
+  CBoRuleRunQueue* queue = (CBoRuleRunQueue*)arg;
+
+  // Pick the first rule
+  unsigned int iRule =
+    __atomic_fetch_add(
+      &(queue->iNextRule),
+      1,
+      __ATOMIC_RELAXED);
+
+  // Loop until there is no more rule
+  while (iRule < CBoRuleId_nb) {
+
+    // Get the run
+    CBoRuleRun* run = queue->runs + iRule;
+
+    // Open a stream on the output buffer of the run, if the output of
+    // the check is displayed
+    if (run->cbo.stream != NULL) {
+
+      run->cbo.stream =
+        open_memstream(
+          &(run->output),
+          &(run->outputSize));
+      if (run->cbo.stream == NULL) {
+
+        run->cbo.err->_type = PBErrTypeIOError;
+        sprintf(
+          run->cbo.err->_msg,
+          "Failed to open the output stream of [%s]",
+          cboRules[iRule].label);
+        PBErrCatch(run->cbo.err);
+
+      }
+
+    }
+
+    // Check the rule
+    run->success =
+      cboRules[iRule].check(
+        &(run->file),
+        &(run->cbo));
+
+    // Close the stream, which updates the output buffer of the run
+    if (run->cbo.stream != NULL) {
+
+      fclose(run->cbo.stream);
+      run->cbo.stream = NULL;
+
+    }
+
+    // Pick the next rule
+    iRule =
+      __atomic_fetch_add(
+        &(queue->iNextRule),
+        1,
+        __ATOMIC_RELAXED);
+
+  }
+
+  // Return NULL
+  return NULL;
+
+}
+
+// Move the output and errors of the CBoRuleRun 'run' to the CBoFile
+// 'that' and the CBo 'cbo' as if the rule was checked on 'that'
+// Return the result of the check of the rule
+bool CBoFileMergeRuleRun(
+     CBoFile* const that,
+         CBo* const cbo,
+  CBoRuleRun* const run) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (run == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'run' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Display the output of the rule
+  if (run->outputSize > 0 && cbo->stream != NULL) {
+
+    fwrite(
+      run->output,
+      1,
+      run->outputSize,
+      cbo->stream);
+
+  }
+
+  // Move the errors to the file in their order, which is sorted on the
+  // line index, so they end up in the same order as if the rule was
+  // checked directly on the file. The errors refer to the copy of the
+  // file, make them refer to the file itself
+  while (GSetNbElem(&(run->file.errors)) > 0) {
+
+    CBoError* error = GSetPop(&(run->file.errors));
+    error->file = that;
+    CBoFileAddError(
+      that,
+      error);
+
+  }
+
+  // Return the result of the check of the rule
+  return run->success;
+
+}
+
+// Free the memory used by the array of CBoRuleRun 'that', including
+// the errors of the runs which have not been merged
+void CBoRuleRunsFree(CBoRuleRun** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Loop on the runs
+  for (
+    unsigned int iRule = 0;
+    iRule < CBoRuleId_nb;
+    ++iRule) {
+
+    // Free the output and the errors of the run
+    CBoRuleRun* run = *that + iRule;
+    free(run->output);
+    while (GSetNbElem(&(run->file.errors)) > 0) {
+
+      CBoError* error = GSetPop(&(run->file.errors));
+      CBoErrorFree(&error);
+
+    }
+
+  }
+
+  // Free the memory
+  free(*that);
+
+  // Set the pointer to null
+  *that = NULL;
+
+}
+
+// Create the CBoPipeline 'that' for the files of the CBo 'cbo'
+// The number of checker threads is 'nbChecker'
+void CBoPipelineInit(
+  CBoPipeline* const that,
+    const CBo* const cbo,
+  const unsigned int nbChecker) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Init the properties
+  that->cbo = *cbo;
+  that->nbFile = GSetNbElem(&(cbo->filePaths));
+  that->paths =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(char*) * (that->nbFile + 1));
+  that->files =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(CBoFile*) * (that->nbFile + 1));
+  that->isPicked =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(bool) * (that->nbFile + 1));
+  that->isLoadFailed =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(bool) * (that->nbFile + 1));
+  that->sizes =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(size_t) * (that->nbFile + 1));
+  that->schedule =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(unsigned int) * (that->nbFile + 1));
+  that->iSchedule = 0;
+  that->nbLoaded = 0;
+  that->nbDeque = (nbChecker > 0 ? nbChecker : 1);
+  that->iNextDeque = 0;
+  that->nbQueued = 0;
+  that->nbMaxQueued = 2 * that->nbDeque;
+  that->memory = 0;
+  that->maxMemory = cbo->maxMemory;
+  that->iEmit = 0;
+  that->flagStop = false;
+  pthread_mutex_init(
+    &(that->mutex),
+    NULL);
+  pthread_cond_init(
+    &(that->condQueued),
+    NULL);
+  pthread_cond_init(
+    &(that->condSpace),
+    NULL);
+  pthread_cond_init(
+    &(that->condDone),
+    NULL);
+
+  // Init the files
+  if (that->nbFile > 0) {
+
+    GSetIterForward iter =
+      GSetIterForwardCreateStatic(&(cbo->filePaths));
+    unsigned int iPath = 0;
+    do {
+
+      that->paths[iPath] = GSetIterGet(&iter);
+      that->files[iPath] = NULL;
+      that->isPicked[iPath] = false;
+      that->isLoadFailed[iPath] = false;
+      ++iPath;
+
+    } while (GSetIterStep(&iter) == true);
+
+  }
+
+  // Create the deques, a loaded file is queued on each deque in turn
+  // so they can't receive more than their share of the files
+  that->deques =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(CBoCheckDeque) * that->nbDeque);
+  for (
+    unsigned int iDeque = 0;
+    iDeque < that->nbDeque;
+    ++iDeque) {
+
+    CBoCheckDeque* deque = that->deques + iDeque;
+    deque->files =
+      PBErrMalloc(
+        cbo->err,
+        sizeof(CBoFile*) * (that->nbFile / that->nbDeque + 1));
+    deque->head = 0;
+    deque->tail = 0;
+
+  }
+
+  // Calculate the order of load of the files
+  CBoPipelineUpdateSchedule(that);
+
+}
+
+// Free the memory used by the CBoPipeline 'that'
+void CBoPipelineFree(CBoPipeline* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Free the deques
+  for (
+    unsigned int iDeque = 0;
+    iDeque < that->nbDeque;
+    ++iDeque) {
+
+    free(that->deques[iDeque].files);
+
+  }
+
+  free(that->deques);
+
+  // Free the properties
+  free(that->paths);
+  free(that->files);
+  free(that->isPicked);
+  free(that->isLoadFailed);
+  free(that->sizes);
+  free(that->schedule);
+  pthread_mutex_destroy(&(that->mutex));
+  pthread_cond_destroy(&(that->condQueued));
+  pthread_cond_destroy(&(that->condSpace));
+  pthread_cond_destroy(&(that->condDone));
+
+}
+
+// Pick the next file to load in the CBoPipeline 'that', waiting for
+// some free space in the deques and memory if necessary. Must be
+// called with the mutex of 'that' locked
+// Return true and set 'iPath' to the index of the file, or return
+// false if there is no more file to load
+bool CBoPipelinePickPath(
+   CBoPipeline* const that,
+  unsigned int* const iPath) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (iPath == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'iPath' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Loop until a file is picked or there is no more file to load
+  while (that->flagStop == false) {
+
+    // Skip the files already picked
+    while (
+      that->iSchedule < that->nbFile &&
+      that->isPicked[that->schedule[that->iSchedule]] == true) {
+
+      ++(that->iSchedule);
+
+    }
+
+    // If all the files have been picked, there is no more file to load
+    if (that->iSchedule == that->nbFile) {
+
+      return false;
+
+    }
+
+    // Declare a variable to memorize the picked file
+    bool isPicked = false;
+
+    // If there is some space in the deques
+    if (that->nbQueued < that->nbMaxQueued) {
+
+      // Get the next file in the order of load
+      *iPath = that->schedule[that->iSchedule];
+
+      // If there is enough memory to load it, or nothing else is
+      // loaded
+      if (
+        that->maxMemory == 0 ||
+        that->memory == 0 ||
+        that->memory + that->sizes[*iPath] <= that->maxMemory) {
+
+        isPicked = true;
+
+      // Else, if the file awaited by the current thread is not loaded
+      // yet, load it even if it exceeds the memory, else the memory
+      // could be filled with files waiting for it and never released
+      } else if (
+        that->iEmit < that->nbFile &&
+        that->isPicked[that->iEmit] == false) {
+
+        *iPath = that->iEmit;
+        isPicked = true;
+
+      }
+
+    }
+
+    // If a file was picked
+    if (isPicked == true) {
+
+      // Reserve its memory and return it
+      that->isPicked[*iPath] = true;
+      that->memory += that->sizes[*iPath];
+      return true;
+
+    }
+
+    // Wait for some free space in the deques or memory
+    pthread_cond_wait(
+      &(that->condSpace),
+      &(that->mutex));
+
+  }
+
+  // The threads are stopped, there is no more file to load
+  return false;
+
+}
+
+// Queue the loaded CBoFile 'file' on the deques of the CBoPipeline
+// 'that'. Must be called with the mutex of 'that' locked
+void CBoPipelinePushFile(
+  CBoPipeline* const that,
+      CBoFile* const file) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (file == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'file' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the deque, in turn according to the number of loaded files.
+  // The files are loaded from the most expensive to the cheapest, so
+  // each deque is sorted by decreasing cost
+  unsigned int iDeque = that->nbLoaded % that->nbDeque;
+  CBoCheckDeque* deque = that->deques + iDeque;
+
+  // Add the file at the tail of the deque
+  deque->files[deque->tail] = file;
+  ++(deque->tail);
+  ++(that->nbQueued);
+
+  // Signal the new file to the checker threads
+  pthread_cond_broadcast(&(that->condQueued));
+
+}
+
+// Pick the next file to check for the thread owning the deque 'iDeque'
+// of the CBoPipeline 'that', from its own deque or stolen from another
+// deque if its own deque is empty, waiting for a file to be loaded if
+// necessary. Must be called with the mutex of 'that' locked
+// Return the file, or NULL if there is no more file to check
+CBoFile* CBoPipelinePickFile(
+  CBoPipeline* const that,
+  const unsigned int iDeque) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (iDeque >= that->nbDeque) {
+
+    CBoErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      CBoErr->_msg,
+      "'iDeque' is invalid (%u<%u)",
+      iDeque,
+      that->nbDeque);
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Loop until a file is picked or there is no more file to check
+  while (that->flagStop == false) {
+
+    // Declare a variable to memorize the picked file
+    CBoFile* file = NULL;
+
+    // Pick the most expensive file at the head of the own deque
+    CBoCheckDeque* deque = that->deques + iDeque;
+    if (deque->head < deque->tail) {
+
+      file = deque->files[deque->head];
+      ++(deque->head);
+
+    }
+
+    // Loop on the other deques until a file is stolen
+    for (
+      unsigned int iOther = 1;
+      iOther < that->nbDeque &&
+      file == NULL;
+      ++iOther) {
+
+      // Steal the cheapest file at the tail of the other deque, to
+      // leave the expensive ones to its owner which is already busy
+      // with a file
+      deque = that->deques + (iDeque + iOther) % that->nbDeque;
+      if (deque->head < deque->tail) {
+
+        --(deque->tail);
+        file = deque->files[deque->tail];
+
+      }
+
+    }
+
+    // If a file was picked
+    if (file != NULL) {
+
+      // Signal the free space to the loader threads and return the file
+      --(that->nbQueued);
+      pthread_cond_broadcast(&(that->condSpace));
+      return file;
+
+    }
+
+    // If all the files are loaded, as the deques are empty there is no
+    // more file to check
+    if (that->nbLoaded == that->nbFile) {
+
+      return NULL;
+
+    }
+
+    // Wait for a file to be loaded
+    pthread_cond_wait(
+      &(that->condQueued),
+      &(that->mutex));
+
+  }
+
+  // The threads are stopped, there is no more file to check
+  return NULL;
+
+}
+
+// Compare the CBoPathCost 'a' and 'b' by decreasing cost, for qsort
+// Return -1, 0 or 1
+int CBoPathCostCmpDesc(
+  const void* a,
+  const void* b) {
+
+  // Get the costs
+  double costA = ((const CBoPathCost*)a)->cost;
+  double costB = ((const CBoPathCost*)b)->cost;
+
+  // Return the result of the comparison
+  if (costA > costB) {
+
+    return -1;
+
+  } else if (costA < costB) {
+
+    return 1;
+
+  } else {
+
+    return 0;
+
+  }
+
+}
+
+// Compare the CBoTiming 'a' and 'b' by path, for qsort and bsearch
+// Return the result of strcmp on their paths
+int CBoTimingCmpPath(
+  const void* a,
+  const void* b) {
+
+  // Return the result of the comparison
+  return
+    strcmp(
+      ((const CBoTiming*)a)->path,
+      ((const CBoTiming*)b)->path);
+
+}
+
+// Calculate the order of load of the files of the CBoPipeline 'that',
+// the most expensive first, from the timings file of a previous run if
+// available, else from their size
+void CBoPipelineUpdateSchedule(CBoPipeline* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If there is no file, nothing to do
+  if (that->nbFile == 0) {
+
+    return;
+
+  }
+
+  // Declare an array to memorize the timings of the previous run
+  CBoTiming* timings = NULL;
+  unsigned int nbTiming = 0;
+  unsigned int sizeTimings = 0;
+
+  // Open the timings file, if any
+  FILE* fp = NULL;
+  if (that->cbo.timingsPath != NULL) {
+
+    fp =
+      fopen(
+        that->cbo.timingsPath,
+        "r");
+
+  }
+
+  // If the timings file could be opened
+  if (fp != NULL) {
+
+    // Declare a buffer to read the path of a file
+    char path[1000];
+
+    // Declare a variable to memorize the time of a file
+    double time = 0.0;
+
+    // Loop on the lines of the timings file, each made of a time and
+    // a path separated by a space
+    while (
+      fscanf(
+        fp,
+        "%lf ",
+        &time) == 1 &&
+      fgets(
+        path,
+        sizeof(path),
+        fp) != NULL) {
+
+      // Remove the line return at the end of the path
+      size_t lengthPath =
+        strcspn(
+          path,
+          "\n");
+      path[lengthPath] = '\0';
+
+      // Grow the array of timings if necessary, the timings are moved
+      // to a bigger array
+      if (nbTiming == sizeTimings) {
+
+        sizeTimings = 2 * sizeTimings + 16;
+        CBoTiming* grownTimings =
+          PBErrMalloc(
+            that->cbo.err,
+            sizeof(CBoTiming) * sizeTimings);
+        if (nbTiming > 0) {
+
+          memcpy(
+            grownTimings,
+            timings,
+            sizeof(CBoTiming) * nbTiming);
+
+        }
+
+        free(timings);
+        timings = grownTimings;
+
+      }
+
+      // Memorize the timing, with a copy of the path
+      timings[nbTiming].path =
+        PBErrMalloc(
+          that->cbo.err,
+          lengthPath + 1);
+      memcpy(
+        timings[nbTiming].path,
+        path,
+        lengthPath + 1);
+      timings[nbTiming].time = time;
+      ++nbTiming;
+
+    }
+
+    fclose(fp);
+
+    // Sort the timings by path to search them
+    qsort(
+      timings,
+      nbTiming,
+      sizeof(CBoTiming),
+      CBoTimingCmpPath);
+
+  }
+
+  // Declare an array to memorize the cost of the files
+  CBoPathCost* costs =
+    PBErrMalloc(
+      that->cbo.err,
+      sizeof(CBoPathCost) * that->nbFile);
+
+  // Declare variables to memorize the total time and size of the files
+  // with a timing
+  double sumTime = 0.0;
+  double sumSize = 0.0;
+
+  // Loop on the files
+  for (
+    unsigned int iPath = 0;
+    iPath < that->nbFile;
+    ++iPath) {
+
+    // Get the size of the file, used as the estimation of the memory it
+    // uses once loaded
+    struct stat fileStat;
+    int ret =
+      stat(
+        that->paths[iPath],
+        &fileStat);
+    that->sizes[iPath] = (ret == 0 ? (size_t)(fileStat.st_size) : 0);
+
+    // Search the timing of the file
+    CBoTiming key;
+    key.path = (char*)(that->paths[iPath]);
+    key.time = 0.0;
+    const CBoTiming* timing = NULL;
+    if (nbTiming > 0) {
+
+      timing =
+        bsearch(
+          &key,
+          timings,
+          nbTiming,
+          sizeof(CBoTiming),
+          CBoTimingCmpPath);
+
+    }
+
+    // If the file has a timing, use it as its cost
+    costs[iPath].iPath = iPath;
+    if (timing != NULL) {
+
+      costs[iPath].cost = timing->time;
+      sumTime += timing->time;
+      sumSize += (double)(that->sizes[iPath]);
+
+    // Else, the cost is unknown yet
+    } else {
+
+      costs[iPath].cost = -1.0;
+
+    }
+
+  }
+
+  // The check time is roughly proportional to the size of the file, get
+  // the time per byte from the files with a timing, or use the size as
+  // cost if there is none
+  double timePerByte = 1.0;
+  if (sumSize > 0.0) {
+
+    timePerByte = sumTime / sumSize;
+
+  }
+
+  // Loop on the files to set the cost of the files without timing
+  for (
+    unsigned int iPath = 0;
+    iPath < that->nbFile;
+    ++iPath) {
+
+    // If the file has no timing, estimate its cost from its size
+    if (costs[iPath].cost < 0.0) {
+
+      costs[iPath].cost = timePerByte * (double)(that->sizes[iPath]);
+
+    }
+
+  }
+
+  // Sort the files by decreasing cost to get the order of load
+  qsort(
+    costs,
+    that->nbFile,
+    sizeof(CBoPathCost),
+    CBoPathCostCmpDesc);
+  for (
+    unsigned int iPath = 0;
+    iPath < that->nbFile;
+    ++iPath) {
+
+    that->schedule[iPath] = costs[iPath].iPath;
+
+  }
+
+  // Free memory
+  free(costs);
+  for (
+    unsigned int iTiming = 0;
+    iTiming < nbTiming;
+    ++iTiming) {
+
+    free(timings[iTiming].path);
+
+  }
+
+  free(timings);
+
+}
+
+// Save the check time of the files of the CBo 'that' in its timings
+// file
+void CBoSaveTimings(const CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If there is no timings file or no file, nothing to do
+  if (
+    that->timingsPath == NULL ||
+    GSetNbElem(&(that->files)) == 0) {
+
+    return;
+
+  }
+
+  // Open the timings file
+  FILE* fp =
+    fopen(
+      that->timingsPath,
+      "w");
+
+  // If the timings file couldn't be opened
+  if (fp == NULL) {
+
+    // Display a message, unless we display only the list of files with
+    // errors, and give up, the timings are only an optimisation
+    if (that->flagListFileError == false) {
+
+      fprintf(
+        that->stream,
+        "Failed to save the timings in [%s]\n",
+        that->timingsPath);
+
+    }
+
+    return;
+
+  }
+
+  // Loop on the files
+  GSetIterForward iter = GSetIterForwardCreateStatic(&(that->files));
+  do {
+
+    // Get the file
+    const CBoFile* file = GSetIterGet(&iter);
+
+    // If the file has been checked, save its check time
+    if (file->isChecked == true) {
+
+      fprintf(
+        fp,
+        "%.6f %s\n",
+        file->checkTime,
+        file->filePath);
+
+    }
+
+  } while (GSetIterStep(&iter) == true);
+
+  fclose(fp);
+
+}
+
+// Keep only the paths of the files in the shard of the CBo 'that',
+// those whose hash modulo the number of shards is the shard index
+// minus one, and memorize their index in the command line
+void CBoSelectShardPaths(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (that->nbShard == 0) {
+
+    CBoErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      CBoErr->_msg,
+      "'that->nbShard' is invalid (%u>0)",
+      that->nbShard);
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Memorize the number of files in the command line
+  that->nbPathAllShard = GSetNbElem(&(that->filePaths));
+  free(that->shardIndexes);
+  that->shardIndexes =
+    PBErrMalloc(
+      that->err,
+      sizeof(unsigned int) * (that->nbPathAllShard + 1));
+
+  // Move the paths of the files of the shard to a new set, in the
+  // order of the command line
+  GSetStr shardPaths = GSetStrCreateStatic();
+  for (
+    unsigned int iPath = 0;
+    iPath < that->nbPathAllShard;
+    ++iPath) {
+
+    char* path = GSetPop(&(that->filePaths));
+
+    // The hash of the path doesn't depend on the machine or the run,
+    // so all the shards agree on the partition of the files
+    uint64_t hash =
+      CBoHashFNV1a(
+        path,
+        (unsigned int)strlen(path));
+    if (hash % that->nbShard == that->iShard - 1) {
+
+      that->shardIndexes[GSetNbElem(&shardPaths)] = iPath;
+      GSetAppend(
+        &shardPaths,
+        path);
+
+    }
+
+  }
+
+  that->filePaths = shardPaths;
+
+}
+
+// Display on the stream of the CBo 'that' the report of the check of
+// the CBoFile 'file' at 'path', NULL if it couldn't be loaded. If
+// 'partial' is not NULL, also save the report in it, with the index
+// 'iPath' of the file in the command line
+void CBoEmitFileReport(
+            CBo* const that,
+     const char* const path,
+  const CBoFile* const file,
+    const unsigned int iPath,
+           FILE* const partial) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (path == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'path' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare the stream on which the report is written: the stream of
+  // the CBo, or a buffer if the report is also saved in the partial
+  // result or if it's made of records
+  FILE* stream = that->stream;
+  char* report = NULL;
+  size_t reportSize = 0;
+  bool isBuffered =
+    (partial != NULL ||
+    that->format != CBoFormat_text);
+  if (isBuffered == true) {
+
+    stream =
+      open_memstream(
+        &report,
+        &reportSize);
+    if (stream == NULL) {
+
+      that->err->_type = PBErrTypeIOError;
+      sprintf(
+        that->err->_msg,
+        "Failed to open the report stream of [%s]",
+        path);
+      PBErrCatch(that->err);
+
+    }
+
+  }
+
+  // If we couldn't load the file and the report is made of records
+  if (
+    file == NULL &&
+    that->format != CBoFormat_text) {
+
+    // Print the record of the failure
+    CBoPrintRecordsHead(
+      that,
+      stream,
+      path);
+    CBoPrintRecord(
+      that,
+      stream,
+      path,
+      0,
+      CBO_RULE_LOAD_FAILED,
+      0);
+
+  // Else, if we couldn't load the file
+  } else if (file == NULL) {
+
+    // Display a message
+    fprintf(
+      stream,
+      "\nFailed to load [%s]\n",
+      path);
+
+  // Else, if we display only the list of files with errors
+  } else if (that->flagListFileError == true) {
+
+    // If the file has error(s), print the file path
+    if (file->isCorrect == false) {
+
+      fprintf(
+        stream,
+        "%s\n",
+        file->filePath);
+
+    }
+
+  // Else, display the output of the check of the file
+  } else if (file->outputSize > 0) {
+
+    fwrite(
+      file->output,
+      1,
+      file->outputSize,
+      stream);
+    fflush(stream);
+
+  }
+
+  // If the report is in a buffer, close it and display the report,
+  // unless it's only sent to the coordinator
+  if (isBuffered == true) {
+
+    fclose(stream);
+    if (that->flagWorker == false) {
+
+      CBoWriteReport(
+        that,
+        report,
+        reportSize);
+
+    }
+
+  }
+
+  // If the report is also saved in the partial result
+  if (partial != NULL) {
+
+    // Get the result of the check of the file
+    CBoFileStatus status = CBoFileStatus_loadFailed;
+    unsigned int nbError = 0;
+    if (file != NULL) {
+
+      status =
+        (file->isCorrect == true ?
+          CBoFileStatus_correct :
+          CBoFileStatus_error);
+      nbError = CBoFileGetNbError(file);
+
+    }
+
+    // Save the result and the report of the file
+    fprintf(
+      partial,
+      "%u %d %u %zu\n",
+      iPath,
+      status,
+      nbError,
+      reportSize);
+    fwrite(
+      report,
+      1,
+      reportSize,
+      partial);
+    fflush(partial);
+
+  }
+
+  // Free the buffer of the report
+  free(report);
+
+}
+
+// Read from the stream 'fp' the result of one file saved by
+// CBoEmitFileReport, into 'record' and its index in the command line
+// into 'iPath'. Set 'isEnd' to true if there is no more result to read
+// Return true if the result could be read or there is no more
+// result, else false
+bool CBoReadPartialRecord(
+         const CBo* const that,
+              FILE* const fp,
+      unsigned int* const iPath,
+  CBoPartialRecord* const record,
+              bool* const isEnd) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (fp == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'fp' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Read the result of the file
+  int status = 0;
+  record->isRead = false;
+  record->report = NULL;
+  int ret =
+    fscanf(
+      fp,
+      "%u %d %u %zu",
+      iPath,
+      &status,
+      &(record->nbError),
+      &(record->reportSize));
+
+  // If we have reached the end of the results
+  *isEnd = (ret == EOF);
+  if (*isEnd == true) {
+
+    return true;
+
+  }
+
+  // Check the result
+  bool success =
+    (ret == 4 &&
+    fgetc(fp) == '\n' &&
+    status >= 0 &&
+    status < CBoFileStatus_nb);
+
+  // If the result is valid, read the report
+  if (success == true) {
+
+    record->isRead = true;
+    record->status = (CBoFileStatus)status;
+    record->report =
+      PBErrMalloc(
+        that->err,
+        record->reportSize + 1);
+    success =
+      (fread(
+        record->report,
+        1,
+        record->reportSize,
+        fp) == record->reportSize);
+    if (success == false) {
+
+      free(record->report);
+      record->report = NULL;
+
+    }
+
+  }
+
+  // Return the success flag
+  return success;
+
+}
+
+// Read the partial result at 'path' into the array 'records', indexed
+// by the index of the files in the command line, allocated on the
+// first partial result and whose size is memorized in the CBo 'that'.
+// The shards already read are flagged in the array 'isShardRead'
+// Return true if the partial result could be read, else false
+bool CBoReadPartialResult(
+                CBo* const that,
+         const char* const path,
+  CBoPartialRecord** const records,
+              bool** const isShardRead) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (path == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'path' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (records == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'records' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (isShardRead == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'isShardRead' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Open the partial result
+  FILE* fp =
+    fopen(
+      path,
+      "r");
+  if (fp == NULL) {
+
+    fprintf(
+      that->stream,
+      "Failed to read the partial result [%s]\n",
+      path);
+    return false;
+
+  }
+
+  // Read the header
+  unsigned int iShard = 0;
+  unsigned int nbShard = 0;
+  unsigned int nbPath = 0;
+  int flagListFileError = 0;
+  int flagFirstError = 0;
+  int format = CBoFormat_text;
+  int ret =
+    fscanf(
+      fp,
+      "CBoPartial %u/%u %u %d %d %d",
+      &iShard,
+      &nbShard,
+      &nbPath,
+      &flagListFileError,
+      &flagFirstError,
+      &format);
+  bool success =
+    (ret == 6 &&
+    format >= CBoFormat_text &&
+    format < CBoFormat_nb &&
+    fgetc(fp) == '\n' &&
+    iShard >= 1 &&
+    iShard <= nbShard);
+
+  // If it's the first partial result
+  if (success == true && *records == NULL) {
+
+    // Memorize the parameters of the run of the shards
+    that->nbShard = nbShard;
+    that->nbPathAllShard = nbPath;
+    that->flagListFileError = (flagListFileError != 0);
+    that->flagFirstError = (flagFirstError != 0);
+    that->format = (CBoFormat)format;
+
+    // Allocate the arrays
+    *records =
+      PBErrMalloc(
+        that->err,
+        sizeof(CBoPartialRecord) * (nbPath + 1));
+    for (
+      unsigned int iPath = 0;
+      iPath < nbPath;
+      ++iPath) {
+
+      (*records)[iPath].isRead = false;
+      (*records)[iPath].report = NULL;
+
+    }
+
+    *isShardRead =
+      PBErrMalloc(
+        that->err,
+        sizeof(bool) * nbShard);
+    for (
+      unsigned int jShard = 0;
+      jShard < nbShard;
+      ++jShard) {
+
+      (*isShardRead)[jShard] = false;
+
+    }
+
+  // Else, check the partial result comes from the same run
+  } else if (success == true) {
+
+    success =
+      (nbShard == that->nbShard &&
+      nbPath == that->nbPathAllShard &&
+      (flagListFileError != 0) == that->flagListFileError &&
+      (flagFirstError != 0) == that->flagFirstError);
+
+  }
+
+  // Check the shard hasn't been read yet
+  if (success == true) {
+
+    success = ((*isShardRead)[iShard - 1] == false);
+    (*isShardRead)[iShard - 1] = true;
+
+  }
+
+  // Loop on the results of the files until the end of the partial
+  // result
+  bool isEnd = false;
+  while (success == true && isEnd == false) {
+
+    // Read the result of the file
+    unsigned int iPath = 0;
+    CBoPartialRecord record;
+    success =
+      CBoReadPartialRecord(
+        that,
+        fp,
+        &iPath,
+        &record,
+        &isEnd);
+
+    // If the result is valid, memorize it if it's the first result of
+    // this file
+    if (success == true && isEnd == false) {
+
+      success =
+        (iPath < that->nbPathAllShard &&
+        (*records)[iPath].isRead == false);
+      if (success == true) {
+
+        (*records)[iPath] = record;
+
+      } else {
+
+        free(record.report);
+
+      }
+
+    }
+
+  }
+
+  // If the partial result is invalid, display a message
+  if (success == false) {
+
+    fprintf(
+      that->stream,
+      "The partial result [%s] is invalid or already merged\n",
+      path);
+
+  }
+
+  // Close the partial result
+  fclose(fp);
+
+  // Return the success flag
+  return success;
+
+}
+
+// Display the report of the file in the 'record' read from a partial
+// result on the stream of the CBo 'that', and add its result to the
+// totals of 'that' and the flags 'allLoaded' and 'allCorrect'
+void CBoEmitPartialRecord(
+                     CBo* const that,
+  const CBoPartialRecord* const record,
+                    bool* const allLoaded,
+                    bool* const allCorrect) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (record == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'record' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Display the report
+  CBoWriteReport(
+    that,
+    record->report,
+    record->reportSize);
+
+  // Update the totals
+  if (record->status == CBoFileStatus_loadFailed) {
+
+    *allLoaded = false;
+
+  } else if (record->status == CBoFileStatus_error) {
+
+    *allCorrect = false;
+    ++(that->nbMergedFileWithError);
+    that->nbMergedError += record->nbError;
+
+  }
+
+}
+
+// Merge the partial results whose paths are the paths of the CBo
+// 'that', display their reports in the order of the command line and
+// memorize their totals
+// Return true if all the files were loaded and correct, else false
+bool CBoMergePartialResults(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Reset the totals
+  that->nbShard = 0;
+  that->nbPathAllShard = 0;
+  that->nbMergedFile = 0;
+  that->nbMergedFileWithError = 0;
+  that->nbMergedError = 0;
+  that->flagInvalidResult = false;
+
+  // Read the partial results
+  CBoPartialRecord* records = NULL;
+  bool* isShardRead = NULL;
+  bool isComplete = true;
+  if (GSetNbElem(&(that->filePaths)) > 0) {
+
+    GSetIterForward iter = GSetIterForwardCreateStatic(&(that->filePaths));
+    do {
+
+      isComplete &=
+        CBoReadPartialResult(
+          that,
+          GSetIterGet(&iter),
+          &records,
+          &isShardRead);
+
+    } while (GSetIterStep(&iter) == true);
+
+  }
+
+  // Check all the shards have been read
+  for (
+    unsigned int iShard = 0;
+    iShard < that->nbShard;
+    ++iShard) {
+
+    if (isShardRead[iShard] == false) {
+
+      fprintf(
+        that->stream,
+        "The partial result of the shard %u/%u is missing\n",
+        iShard + 1,
+        that->nbShard);
+      isComplete = false;
+
+    }
+
+  }
+
+  // Print the head of the output, in the format of the partial results
+  CBoPrintOutputHead(that);
+
+  // Loop on the files in the order of the command line, as they would
+  // have been displayed by an unsharded run. Each shard stops at its
+  // own first error if requested, which is never before the first
+  // error of all the shards
+  bool allLoaded = true;
+  bool allCorrect = true;
+  for (
+    unsigned int iPath = 0;
+    iPath < that->nbPathAllShard &&
+    isComplete == true &&
+    (that->flagFirstError == false || allCorrect == true);
+    ++iPath) {
+
+    // If the result of the file is missing
+    CBoPartialRecord* record = records + iPath;
+    if (record->isRead == false) {
+
+      fprintf(
+        that->stream,
+        "The result of the file #%u is missing\n",
+        iPath + 1);
+      isComplete = false;
+
+    // Else, display the report of the file and update the totals
+    } else {
+
+      CBoEmitPartialRecord(
+        that,
+        record,
+        &allLoaded,
+        &allCorrect);
+
+    }
+
+  }
+
+  // Memorize the number of files of the merged run, and if it's
+  // incomplete
+  that->nbMergedFile = that->nbPathAllShard;
+  that->flagInvalidResult = (isComplete == false);
+
+  // Free memory
+  if (records != NULL) {
+
+    for (
+      unsigned int iPath = 0;
+      iPath < that->nbPathAllShard;
+      ++iPath) {
+
+      free(records[iPath].report);
+
+    }
+
+  }
+
+  free(records);
+  free(isShardRead);
+
+  // Return the success flag
+  return isComplete & allLoaded & allCorrect;
+
+}
+
+// Distribute the files of the CBo 'that' to the worker processes
+// connecting on its socket and display their results in the order of
+// the command line as they come back
+// Return true if all the files were loaded and correct, else false
+bool CBoCoordinate(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Ignore SIGPIPE, a worker process disconnecting is detected by the
+  // failure of the write instead
+  signal(
+    SIGPIPE,
+    SIG_IGN);
+
+  // Create the socket listening for the worker processes
+  struct sockaddr_un address;
+  memset(
+    &address,
+    0,
+    sizeof(address));
+  address.sun_family = AF_UNIX;
+  int fd = -1;
+  if (strlen(that->socketPath) < sizeof(address.sun_path)) {
+
+    strcpy(
+      address.sun_path,
+      that->socketPath);
+    unlink(that->socketPath);
+    fd =
+      socket(
+        AF_UNIX,
+        SOCK_STREAM,
+        0);
+
+  }
+
+  if (
+    fd < 0 ||
+    bind(
+      fd,
+      (struct sockaddr*)&address,
+      sizeof(address)) != 0 ||
+    listen(
+      fd,
+      SOMAXCONN) != 0) {
+
+    fprintf(
+      that->stream,
+      "Failed to listen on [%s]\n",
+      that->socketPath);
+    if (fd >= 0) {
+
+      close(fd);
+
+    }
+
+    return false;
+
+  }
+
+  // Create the coordinator
+  CBoCoordinator coordinator;
+  coordinator.cbo = *that;
+  coordinator.socket = fd;
+  coordinator.nbPath = GSetNbElem(&(that->filePaths));
+  coordinator.paths =
+    PBErrMalloc(
+      that->err,
+      sizeof(char*) * (coordinator.nbPath + 1));
+  coordinator.records =
+    PBErrMalloc(
+      that->err,
+      sizeof(CBoPartialRecord) * (coordinator.nbPath + 1));
+  coordinator.retryPaths =
+    PBErrMalloc(
+      that->err,
+      sizeof(unsigned int) * (coordinator.nbPath + 1));
+  if (coordinator.nbPath > 0) {
+
+    GSetIterForward iter =
+      GSetIterForwardCreateStatic(&(that->filePaths));
+    unsigned int iPath = 0;
+    do {
+
+      coordinator.paths[iPath] = GSetIterGet(&iter);
+      coordinator.records[iPath].isRead = false;
+      coordinator.records[iPath].report = NULL;
+      ++iPath;
+
+    } while (GSetIterStep(&iter) == true);
+
+  }
+
+  coordinator.iNextPath = 0;
+  coordinator.nbRetry = 0;
+  coordinator.nbWorker = 0;
+  coordinator.flagStop = false;
+  pthread_mutex_init(
+    &(coordinator.mutex),
+    NULL);
+  pthread_cond_init(
+    &(coordinator.condRead),
+    NULL);
+  pthread_cond_init(
+    &(coordinator.condWork),
+    NULL);
+
+  // Start the thread accepting the worker processes
+  pthread_t thread;
+  bool isStarted =
+    (pthread_create(
+      &thread,
+      NULL,
+      CBoAcceptWorker,
+      &coordinator) == 0);
+  if (isStarted == false) {
+
+    fprintf(
+      that->stream,
+      "Failed to accept the worker processes\n");
+
+  }
+
+  // Loop on the files in the order of the command line, to display
+  // their result as soon as it's received
+  bool allLoaded = true;
+  bool allCorrect = true;
+  for (
+    unsigned int iPath = 0;
+    iPath < coordinator.nbPath &&
+    isStarted == true &&
+    (that->flagFirstError == false || allCorrect == true);
+    ++iPath) {
+
+    // Wait for the result of the file
+    pthread_mutex_lock(&(coordinator.mutex));
+    while (coordinator.records[iPath].isRead == false) {
+
+      pthread_cond_wait(
+        &(coordinator.condRead),
+        &(coordinator.mutex));
+
+    }
+
+    pthread_mutex_unlock(&(coordinator.mutex));
+
+    // Display the result of the file
+    CBoEmitPartialRecord(
+      that,
+      coordinator.records + iPath,
+      &allLoaded,
+      &allCorrect);
+
+  }
+
+  // Stop the distribution and wait for the end of the connections
+  if (isStarted == true) {
+
+    pthread_mutex_lock(&(coordinator.mutex));
+    coordinator.flagStop = true;
+    pthread_cond_broadcast(&(coordinator.condWork));
+    pthread_mutex_unlock(&(coordinator.mutex));
+    pthread_join(
+      thread,
+      NULL);
+
+  }
+
+  // Close the socket
+  close(fd);
+  unlink(that->socketPath);
+
+  // Free memory
+  for (
+    unsigned int iPath = 0;
+    iPath < coordinator.nbPath;
+    ++iPath) {
+
+    free(coordinator.records[iPath].report);
+
+  }
+
+  free(coordinator.paths);
+  free(coordinator.records);
+  free(coordinator.retryPaths);
+  pthread_mutex_destroy(&(coordinator.mutex));
+  pthread_cond_destroy(&(coordinator.condRead));
+  pthread_cond_destroy(&(coordinator.condWork));
+
+  // Return the success flag
+  return isStarted & allLoaded & allCorrect;
+
+}
+
+// Main function of the thread accepting the worker processes on the
+// socket of the CBoCoordinator 'arg', and starting a thread serving
+// each of them, until the coordinator is stopped
+// Return NULL
+void* CBoAcceptWorker(void* arg) {
+
+#if BUILDMODE == 0
+  if (arg == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'arg' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the coordinator
+  CBoCoordinator* coordinator = (CBoCoordinator*)arg;
+
+  // Declare the set of connections
+  GSet links = GSetCreateStatic();
+
+  // Loop until the coordinator is stopped
+  struct pollfd pollFd;
+  pollFd.fd = coordinator->socket;
+  pollFd.events = POLLIN;
+  pthread_mutex_lock(&(coordinator->mutex));
+  while (coordinator->flagStop == false) {
+
+    // Wait for a worker process, checking regularly for the stop
+    pthread_mutex_unlock(&(coordinator->mutex));
+    pollFd.revents = 0;
+    int ret =
+      poll(
+        &pollFd,
+        1,
+        CBO_COORDINATOR_POLL_MS);
+
+    // If a worker process is connecting
+    if (ret > 0) {
+
+      // Accept it and start the thread serving it
+      int fd =
+        accept(
+          coordinator->socket,
+          NULL,
+          NULL);
+      if (fd >= 0) {
+
+        CBoWorkerLink* link =
+          PBErrMalloc(
+            coordinator->cbo.err,
+            sizeof(CBoWorkerLink));
+        link->coordinator = coordinator;
+        link->socket = fd;
+        ret =
+          pthread_create(
+            &(link->thread),
+            NULL,
+            CBoServeWorker,
+            link);
+        if (ret == 0) {
+
+          GSetAppend(
+            &links,
+            link);
+
+        } else {
+
+          close(fd);
+          free(link);
+
+        }
+
+      }
+
+    }
+
+    pthread_mutex_lock(&(coordinator->mutex));
+
+  }
+
+  pthread_mutex_unlock(&(coordinator->mutex));
+
+  // Wait for the end of the connections
+  while (GSetNbElem(&links) > 0) {
+
+    CBoWorkerLink* link = GSetPop(&links);
+    pthread_join(
+      link->thread,
+      NULL);
+    free(link);
+
+  }
+
+  // Return NULL
+  return NULL;
+
+}
+
+// Main function of the thread serving one worker process through the
+// CBoWorkerLink 'arg': send it batches of files and receive their
+// results until there is no more file or it disconnects
+// Return NULL
+void* CBoServeWorker(void* arg) {
+
+#if BUILDMODE == 0
+  if (arg == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'arg' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the connection and the coordinator
+  CBoWorkerLink* link = (CBoWorkerLink*)arg;
+  CBoCoordinator* coordinator = link->coordinator;
+  const CBo* cbo = &(coordinator->cbo);
+
+  // Open the streams on the socket
+  FILE* in =
+    fdopen(
+      link->socket,
+      "r");
+  FILE* out = NULL;
+  int fdOut = dup(link->socket);
+  if (fdOut >= 0) {
+
+    out =
+      fdopen(
+        fdOut,
+        "w");
+
+  }
+
+  // Send the options of the check
+  bool isConnected = (in != NULL && out != NULL);
+  if (isConnected == true) {
+
+    fprintf(
+      out,
+      "CBoOptions %d %d %u %u %d %d\n",
+      cbo->flagListFileError,
+      cbo->flagFirstError,
+      cbo->nbMaxErrorPerFile,
+      cbo->nbLineParallelRules,
+      cbo->flagColor,
+      cbo->format);
+
+  }
+
+  // Pick the first batch
+  unsigned int batch[CBO_BATCH_MAX_NB_FILE];
+  bool isReceived[CBO_BATCH_MAX_NB_FILE];
+  unsigned int nbBatch = 0;
+  pthread_mutex_lock(&(coordinator->mutex));
+  ++(coordinator->nbWorker);
+  if (isConnected == true) {
+
+    nbBatch =
+      CBoCoordinatorPickBatch(
+        coordinator,
+        batch);
+
+  }
+
+  pthread_mutex_unlock(&(coordinator->mutex));
+
+  // Loop on the batches
+  while (nbBatch > 0) {
+
+    // Send the batch
+    fprintf(
+      out,
+      "CBoBatch %u\n",
+      nbBatch);
+    for (
+      unsigned int iBatch = 0;
+      iBatch < nbBatch;
+      ++iBatch) {
+
+      fprintf(
+        out,
+        "%u %s\n",
+        batch[iBatch],
+        coordinator->paths[batch[iBatch]]);
+      isReceived[iBatch] = false;
+
+    }
+
+    isConnected = (fflush(out) == 0);
+
+    // Receive the results of the files until the end of the batch, a
+    // batch can end early if the check stops at the first error
+    bool isEnd = (isConnected == false);
+    while (isEnd == false) {
+
+      // If it's the end of the batch
+      int c = fgetc(in);
+      if (c == 'C') {
+
+        isEnd = true;
+        isConnected =
+          (fscanf(
+            in,
+            "BoBatchEnd") == 0 &&
+          fgetc(in) == '\n');
+
+      // Else, receive the result of one file
+      } else {
+
+        ungetc(
+          c,
+          in);
+        unsigned int iPath = 0;
+        CBoPartialRecord record;
+        isConnected =
+          CBoReadPartialRecord(
+            cbo,
+            in,
+            &iPath,
+            &record,
+            &isEnd);
+        isConnected &= (isEnd == false);
+
+        // Check the file is in the batch and hasn't been received yet
+        unsigned int iBatch = 0;
+        while (
+          iBatch < nbBatch &&
+          (batch[iBatch] != iPath || isReceived[iBatch] == true)) {
+
+          ++iBatch;
+
+        }
+
+        isConnected &= (iBatch < nbBatch);
+
+        // If the result is valid, memorize it and signal it
+        if (isConnected == true) {
+
+          isReceived[iBatch] = true;
+          pthread_mutex_lock(&(coordinator->mutex));
+          coordinator->records[iPath] = record;
+          pthread_cond_broadcast(&(coordinator->condRead));
+          pthread_mutex_unlock(&(coordinator->mutex));
+
+        } else {
+
+          free(record.report);
+          isEnd = true;
+
+        }
+
+      }
+
+    }
+
+    // If the worker process disconnected, the files whose result
+    // hasn't been received are sent again to another worker process.
+    // If the batch ended early because of the first error, they are
+    // not needed
+    pthread_mutex_lock(&(coordinator->mutex));
+    if (isConnected == false || cbo->flagFirstError == false) {
+
+      for (
+        unsigned int iBatch = 0;
+        iBatch < nbBatch;
+        ++iBatch) {
+
+        if (isReceived[iBatch] == false) {
+
+          coordinator->retryPaths[coordinator->nbRetry] = batch[iBatch];
+          ++(coordinator->nbRetry);
+
+        }
+
+      }
+
+      pthread_cond_broadcast(&(coordinator->condWork));
+
+    }
+
+    // Pick the next batch
+    nbBatch = 0;
+    if (isConnected == true) {
+
+      nbBatch =
+        CBoCoordinatorPickBatch(
+          coordinator,
+          batch);
+
+    }
+
+    pthread_mutex_unlock(&(coordinator->mutex));
+
+  }
+
+  // Tell the worker process there is no more file
+  if (isConnected == true) {
+
+    fprintf(
+      out,
+      "CBoBatch 0\n");
+    fflush(out);
+
+  }
+
+  // Close the streams
+  pthread_mutex_lock(&(coordinator->mutex));
+  --(coordinator->nbWorker);
+  pthread_mutex_unlock(&(coordinator->mutex));
+  if (in != NULL) {
+
+    fclose(in);
+
+  } else {
+
+    close(link->socket);
+
+  }
+
+  if (out != NULL) {
+
+    fclose(out);
+
+  } else if (fdOut >= 0) {
+
+    close(fdOut);
+
+  }
+
+  // Return NULL
+  return NULL;
+
+}
+
+// Pick in 'batch' the next files to send to a worker process from the
+// CBoCoordinator 'that', waiting for files to send if necessary. Must
+// be called with the mutex of 'that' locked
+// Return the number of files in the batch, 0 if the coordinator is
+// stopped
+unsigned int CBoCoordinatorPickBatch(
+  CBoCoordinator* const that,
+    unsigned int* const batch) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (batch == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'batch' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Wait for files to send, the files of a worker process which
+  // disconnected may come back until all the results are received
+  while (
+    that->flagStop == false &&
+    that->nbRetry == 0 &&
+    that->iNextPath >= that->nbPath) {
+
+    pthread_cond_wait(
+      &(that->condWork),
+      &(that->mutex));
+
+  }
+
+  // If the coordinator is stopped, there is no more batch
+  if (that->flagStop == true) {
+
+    return 0;
+
+  }
+
+  // Send the files to send again first
+  unsigned int nbBatch = 0;
+  while (
+    that->nbRetry > 0 &&
+    nbBatch < CBO_BATCH_MAX_NB_FILE) {
+
+    --(that->nbRetry);
+    batch[nbBatch] = that->retryPaths[that->nbRetry];
+    ++nbBatch;
+
+  }
+
+  // If there was no file to send again
+  if (nbBatch == 0) {
+
+    // Get the size of the batch, a fraction of the share of the
+    // remaining files of each worker process
+    unsigned int size =
+      (that->nbPath - that->iNextPath) /
+      (CBO_BATCH_NB_PER_WORKER * that->nbWorker);
+    if (size > CBO_BATCH_MAX_NB_FILE) {
+
+      size = CBO_BATCH_MAX_NB_FILE;
+
+    }
+
+    if (size == 0) {
+
+      size = 1;
+
+    }
+
+    // Pick the next files
+    while (nbBatch < size) {
+
+      batch[nbBatch] = that->iNextPath;
+      ++(that->iNextPath);
+      ++nbBatch;
+
+    }
+
+  }
+
+  // Sort the batch in the order of the command line, the check of a
+  // batch stopping at its first error must not skip a file before the
+  // first error of all the files
+  for (
+    unsigned int iBatch = 1;
+    iBatch < nbBatch;
+    ++iBatch) {
+
+    unsigned int iPath = batch[iBatch];
+    unsigned int jBatch = iBatch;
+    while (jBatch > 0 && batch[jBatch - 1] > iPath) {
+
+      batch[jBatch] = batch[jBatch - 1];
+      --jBatch;
+
+    }
+
+    batch[jBatch] = iPath;
+
+  }
+
+  // Return the number of files in the batch
+  return nbBatch;
+
+}
+
+// Connect the CBo 'that' as a worker process to the coordinator on its
+// socket, and check the batches of files it sends until there is no
+// more file, sending back their results
+// Return true if the connection was successfull, else false
+bool CBoWork(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Ignore SIGPIPE, a coordinator disconnecting is detected by the
+  // failure of the write instead
+  signal(
+    SIGPIPE,
+    SIG_IGN);
+
+  // Connect to the coordinator, waiting for it to listen if necessary
+  struct sockaddr_un address;
+  memset(
+    &address,
+    0,
+    sizeof(address));
+  address.sun_family = AF_UNIX;
+  int fd = -1;
+  bool isConnected = false;
+  if (strlen(that->socketPath) < sizeof(address.sun_path)) {
+
+    strcpy(
+      address.sun_path,
+      that->socketPath);
+    fd =
+      socket(
+        AF_UNIX,
+        SOCK_STREAM,
+        0);
+
+  }
+
+  for (
+    unsigned int iTry = 0;
+    iTry < CBO_WORKER_NB_CONNECT_TRY &&
+    fd >= 0 &&
+    isConnected == false;
+    ++iTry) {
+
+    isConnected =
+      (connect(
+        fd,
+        (struct sockaddr*)&address,
+        sizeof(address)) == 0);
+    if (isConnected == false) {
+
+      struct timespec delay;
+      delay.tv_sec = 0;
+      delay.tv_nsec = CBO_COORDINATOR_POLL_MS * 1000000L;
+      nanosleep(
+        &delay,
+        NULL);
+
+    }
+
+  }
+
+  // Open the streams on the socket
+  FILE* in = NULL;
+  FILE* out = NULL;
+  if (isConnected == true) {
+
+    in =
+      fdopen(
+        fd,
+        "r");
+    int fdOut = dup(fd);
+    if (fdOut >= 0) {
+
+      out =
+        fdopen(
+          fdOut,
+          "w");
+
+    }
+
+    isConnected = (in != NULL && out != NULL);
+
+  }
+
+  // Receive the options of the check
+  int flagListFileError = 0;
+  int flagFirstError = 0;
+  int flagColor = 0;
+  int format = CBoFormat_text;
+  if (isConnected == true) {
+
+    isConnected =
+      (fscanf(
+        in,
+        "CBoOptions %d %d %u %u %d %d",
+        &flagListFileError,
+        &flagFirstError,
+        &(that->nbMaxErrorPerFile),
+        &(that->nbLineParallelRules),
+        &flagColor,
+        &format) == 6 &&
+      fgetc(in) == '\n' &&
+      format >= CBoFormat_text &&
+      format < CBoFormat_nb);
+    that->flagListFileError = (flagListFileError != 0);
+    that->flagFirstError = (flagFirstError != 0);
+    that->flagColor = (flagColor != 0);
+    that->format = (CBoFormat)format;
+
+  }
+
+  if (isConnected == false) {
+
+    fprintf(
+      that->stream,
+      "Failed to connect to the coordinator on [%s]\n",
+      that->socketPath);
+
+  }
+
+  // Loop on the batches of files until the coordinator has no more
+  // files
+  unsigned int nbBatch = 0;
+  while (
+    isConnected == true &&
+    fscanf(
+      in,
+      "CBoBatch %u",
+      &nbBatch) == 1 &&
+    fgetc(in) == '\n' &&
+    nbBatch > 0) {
+
+    // Receive the paths of the files of the batch and their index in
+    // the command line of the coordinator
+    char** paths =
+      PBErrMalloc(
+        that->err,
+        sizeof(char*) * nbBatch);
+    free(that->shardIndexes);
+    that->shardIndexes =
+      PBErrMalloc(
+        that->err,
+        sizeof(unsigned int) * nbBatch);
+    for (
+      unsigned int iBatch = 0;
+      iBatch < nbBatch;
+      ++iBatch) {
+
+      paths[iBatch] = NULL;
+      size_t size = 0;
+      if (
+        isConnected == true &&
+        fscanf(
+          in,
+          "%u",
+          that->shardIndexes + iBatch) == 1 &&
+        fgetc(in) == ' ' &&
+        getline(
+          paths + iBatch,
+          &size,
+          in) > 0) {
+
+        paths[iBatch][strcspn(paths[iBatch], "\n")] = '\0';
+        GSetAppend(
+          &(that->filePaths),
+          paths[iBatch]);
+
+      } else {
+
+        isConnected = false;
+
+      }
+
+    }
+
+    // Check the files of the batch, their results are sent as soon as
+    // they are available, then signal the end of the batch
+    if (isConnected == true) {
+
+      CBoCheckFiles(
+        that,
+        out);
+      fprintf(
+        out,
+        "CBoBatchEnd\n");
+      isConnected = (fflush(out) == 0);
+
+    }
+
+    // Free the files of the batch
+    GSetFlush(&(that->filePaths));
+    GSetFlush(&(that->filesWithError));
+    while (GSetNbElem(&(that->files)) > 0) {
+
+      CBoFile* file = GSetPop(&(that->files));
+      CBoFileFree(&file);
+
+    }
+
+    for (
+      unsigned int iBatch = 0;
+      iBatch < nbBatch;
+      ++iBatch) {
+
+      free(paths[iBatch]);
+
+    }
+
+    free(paths);
+
+  }
+
+  // Close the connection
+  if (in != NULL) {
+
+    fclose(in);
+
+  } else if (fd >= 0) {
+
+    close(fd);
+
+  }
+
+  if (out != NULL) {
+
+    fclose(out);
+
+  }
+
+  // Return the success flag
+  return isConnected;
+
+}
+
+// Compare the CBoSampleKey 'a' and 'b' by directory, then by key, for
+// qsort
+// Return -1, 0 or 1
+int CBoSampleKeyCmp(
+  const void* a,
+  const void* b) {
+
+#if BUILDMODE == 0
+  if (a == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'a' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (b == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'b' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  const CBoSampleKey* keyA = (const CBoSampleKey*)a;
+  const CBoSampleKey* keyB = (const CBoSampleKey*)b;
+
+  // Compare the directories
+  unsigned int length =
+    (keyA->lengthDir < keyB->lengthDir ?
+      keyA->lengthDir :
+      keyB->lengthDir);
+  int ret =
+    memcmp(
+      keyA->path,
+      keyB->path,
+      length);
+  if (ret != 0) {
+
+    return (ret < 0 ? -1 : 1);
+
+  }
+
+  if (keyA->lengthDir != keyB->lengthDir) {
+
+    return (keyA->lengthDir < keyB->lengthDir ? -1 : 1);
+
+  }
+
+  // Compare the keys, the index is used to keep the order total
+  if (keyA->key != keyB->key) {
+
+    return (keyA->key < keyB->key ? -1 : 1);
+
+  }
+
+  return (keyA->iPath < keyB->iPath ? -1 : 1);
+
+}
+
+// Keep only a sample of the paths of the CBo 'that': in each directory
+// (stratum), the files with the smallest pseudo random keys, in
+// proportion of the percentage of sampling and at least one. The keys
+// depend only on the paths and the seed, hence the sample is the same
+// for the same files and seed
+void CBoSelectSamplePaths(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the keys of the files
+  unsigned int nbPath = GSetNbElem(&(that->filePaths));
+  CBoSampleKey* keys =
+    PBErrMalloc(
+      that->err,
+      sizeof(CBoSampleKey) * (nbPath + 1));
+  for (
+    unsigned int iPath = 0;
+    iPath < nbPath;
+    ++iPath) {
+
+    CBoSampleKey* key = keys + iPath;
+    key->path = GSetPop(&(that->filePaths));
+    key->iPath = iPath;
+    const char* slash =
+      strrchr(
+        key->path,
+        '/');
+    key->lengthDir = (slash != NULL ? slash - key->path : 0);
+
+    // Mix the seed in the hash of the path, and spread its bits with a
+    // full finalizer so the keys of close seeds are unrelated
+    uint64_t hash =
+      CBoHashFNV1a(
+        key->path,
+        (unsigned int)strlen(key->path));
+    key->key = CBoHashMix64(hash ^ that->sampleSeed);
+
+  }
+
+  // Sort the files by directory, then by key
+  qsort(
+    keys,
+    nbPath,
+    sizeof(CBoSampleKey),
+    CBoSampleKeyCmp);
+
+  // Declare an array to memorize the stratum of each file, or nbPath if
+  // it's not sampled
+  unsigned int* strata =
+    PBErrMalloc(
+      that->err,
+      sizeof(unsigned int) * (nbPath + 1));
+  free(that->stratumNbPath);
+  that->stratumNbPath =
+    PBErrMalloc(
+      that->err,
+      sizeof(unsigned int) * (nbPath + 1));
+  that->nbStratum = 0;
+
+  // Loop on the strata
+  unsigned int iFirst = 0;
+  while (iFirst < nbPath) {
+
+    // Get the end of the stratum
+    unsigned int iEnd = iFirst + 1;
+    while (
+      iEnd < nbPath &&
+      keys[iEnd].lengthDir == keys[iFirst].lengthDir &&
+      memcmp(
+        keys[iEnd].path,
+        keys[iFirst].path,
+        keys[iFirst].lengthDir) == 0) {
+
+      ++iEnd;
+
+    }
+
+    // Get the number of sampled files in the stratum
+    unsigned int nbPathStratum = iEnd - iFirst;
+    unsigned int nbSample =
+      (unsigned int)(
+        (double)nbPathStratum * that->samplePercent / 100.0 + 0.5);
+    if (nbSample == 0) {
+
+      nbSample = 1;
+
+    }
+
+    // Memorize the stratum of the files, the first ones by key are
+    // sampled
+    for (
+      unsigned int iKey = iFirst;
+      iKey < iEnd;
+      ++iKey) {
+
+      strata[keys[iKey].iPath] =
+        (iKey - iFirst < nbSample ? that->nbStratum : nbPath);
+
+    }
+
+    that->stratumNbPath[that->nbStratum] = nbPathStratum;
+    ++(that->nbStratum);
+    iFirst = iEnd;
+
+  }
+
+  // Put back the sampled files in the order of the arguments, and
+  // memorize their stratum
+  qsort(
+    keys,
+    nbPath,
+    sizeof(CBoSampleKey),
+    CBoSampleKeyCmpIndex);
+  free(that->sampleStrata);
+  that->sampleStrata =
+    PBErrMalloc(
+      that->err,
+      sizeof(unsigned int) * (nbPath + 1));
+  for (
+    unsigned int iPath = 0;
+    iPath < nbPath;
+    ++iPath) {
+
+    if (strata[iPath] < nbPath) {
+
+      that->sampleStrata[GSetNbElem(&(that->filePaths))] = strata[iPath];
+      GSetAppend(
+        &(that->filePaths),
+        keys[iPath].path);
+
+    }
+
+  }
+
+  // Free memory
+  free(keys);
+  free(strata);
+
+}
+
+// Compare the CBoSampleKey 'a' and 'b' by index in the arguments, for
+// qsort
+// Return -1, 0 or 1
+int CBoSampleKeyCmpIndex(
+  const void* a,
+  const void* b) {
+
+#if BUILDMODE == 0
+  if (a == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'a' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (b == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'b' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  unsigned int iPathA = ((const CBoSampleKey*)a)->iPath;
+  unsigned int iPathB = ((const CBoSampleKey*)b)->iPath;
+  if (iPathA == iPathB) {
+
+    return 0;
+
+  }
+
+  return (iPathA < iPathB ? -1 : 1);
+
+}
+
+// Display the estimation of the number of errors of each type on all
+// the files of the CBo 'that' from its checked sample, with their 95%
+// confidence interval. The stratified estimator of the total is used:
+// sum over the strata of the number of files times the mean of the
+// sampled files
+void CBoPrintSampleEstimate(const CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the number of errors of each type, and in total, in each
+  // sampled file. The files are in the order of their path, without
+  // the ones which couldn't be loaded, and the unchecked files (after
+  // the first error) are ignored
+  unsigned int nbSample = GSetNbElem(&(that->filePaths));
+  unsigned int nbCol = CBoErrorType_nb + 1;
+  double* counts =
+    PBErrMalloc(
+      that->err,
+      sizeof(double) * nbCol * (nbSample + 1));
+  bool* isChecked =
+    PBErrMalloc(
+      that->err,
+      sizeof(bool) * (nbSample + 1));
+  GSetIterForward iterFile = GSetIterForwardCreateStatic(&(that->files));
+  CBoFile* file = GSetIterGet(&iterFile);
+  if (nbSample > 0) {
+
+    GSetIterForward iterPath =
+      GSetIterForwardCreateStatic(&(that->filePaths));
+    unsigned int iSample = 0;
+    do {
+
+      // Reset the counts of the file
+      const char* path = GSetIterGet(&iterPath);
+      isChecked[iSample] = false;
+      for (
+        unsigned int iCol = 0;
+        iCol < nbCol;
+        ++iCol) {
+
+        counts[iSample * nbCol + iCol] = 0.0;
+
+      }
+
+      // If the file of this path was loaded
+      if (file != NULL && file->filePath == path) {
+
+        // Count its errors if it was checked, the aborted checks are
+        // ignored as their errors are unknown
+        isChecked[iSample] =
+          (file->isChecked == true && file->isAborted == false);
+        if (
+          isChecked[iSample] == true &&
+          GSetNbElem(&(file->errors)) > 0) {
+
+          GSetIterForward iterError =
+            GSetIterForwardCreateStatic(&(file->errors));
+          do {
+
+            const CBoError* error = GSetIterGet(&iterError);
+            counts[iSample * nbCol + error->type] += 1.0;
+            counts[iSample * nbCol + CBoErrorType_nb] += 1.0;
+
+          } while (GSetIterStep(&iterError) == true);
+
+        }
+
+        // Move to the next file
+        file =
+          (GSetIterStep(&iterFile) == true ?
+            GSetIterGet(&iterFile) :
+            NULL);
+
+      }
+
+      ++iSample;
+
+    } while (GSetIterStep(&iterPath) == true);
+
+  }
+
+  // Get the number of files, and the number of files in the strata
+  // having at least one checked file, the other strata can't be
+  // estimated
+  unsigned int* nbChecked =
+    PBErrMalloc(
+      that->err,
+      sizeof(unsigned int) * (that->nbStratum + 1));
+  for (
+    unsigned int iStratum = 0;
+    iStratum < that->nbStratum;
+    ++iStratum) {
+
+    nbChecked[iStratum] = 0;
+
+  }
+
+  unsigned int nbCheckedAll = 0;
+  for (
+    unsigned int iSample = 0;
+    iSample < nbSample;
+    ++iSample) {
+
+    if (isChecked[iSample] == true) {
+
+      ++(nbChecked[that->sampleStrata[iSample]]);
+      ++nbCheckedAll;
+
+    }
+
+  }
+
+  unsigned int nbPath = 0;
+  unsigned int nbPathEstimated = 0;
+  for (
+    unsigned int iStratum = 0;
+    iStratum < that->nbStratum;
+    ++iStratum) {
+
+    nbPath += that->stratumNbPath[iStratum];
+    if (nbChecked[iStratum] > 0) {
+
+      nbPathEstimated += that->stratumNbPath[iStratum];
+
+    }
+
+  }
+
+  // Display the header of the estimation
+  fprintf(
+    that->stream,
+    "\nEstimation on %u files from a sample of %u files in %u "
+    "directories (%.1f%%, seed %u), with 95%% confidence intervals:\n",
+    nbPath,
+    nbCheckedAll,
+    that->nbStratum,
+    that->samplePercent,
+    that->sampleSeed);
+  if (nbPathEstimated < nbPath) {
+
+    fprintf(
+      that->stream,
+      "(%u files in directories without checked file are not "
+      "estimated)\n",
+      nbPath - nbPathEstimated);
+
+  }
+
+  // Declare arrays for the sums per stratum
+  double* sums =
+    PBErrMalloc(
+      that->err,
+      sizeof(double) * (that->nbStratum + 1));
+  double* sumsSquare =
+    PBErrMalloc(
+      that->err,
+      sizeof(double) * (that->nbStratum + 1));
+
+  // Loop on the types of error, and the total
+  for (
+    unsigned int iCol = 0;
+    iCol < nbCol;
+    ++iCol) {
+
+    // Get the sums per stratum, and on all the sample
+    for (
+      unsigned int iStratum = 0;
+      iStratum < that->nbStratum;
+      ++iStratum) {
+
+      sums[iStratum] = 0.0;
+      sumsSquare[iStratum] = 0.0;
+
+    }
+
+    double sum = 0.0;
+    double sumSquare = 0.0;
+    for (
+      unsigned int iSample = 0;
+      iSample < nbSample;
+      ++iSample) {
+
+      if (isChecked[iSample] == true) {
+
+        double count = counts[iSample * nbCol + iCol];
+        sums[that->sampleStrata[iSample]] += count;
+        sumsSquare[that->sampleStrata[iSample]] += count * count;
+        sum += count;
+        sumSquare += count * count;
+
+      }
+
+    }
+
+    // Get the variance on all the sample, used for the strata with only
+    // one checked file whose variance can't be estimated
+    double variancePooled = 0.0;
+    if (nbCheckedAll > 1) {
+
+      variancePooled =
+        (sumSquare - sum * sum / (double)nbCheckedAll) /
+        (double)(nbCheckedAll - 1);
+
+    }
+
+    // Get the estimation of the total and its variance, each stratum
+    // contributes its size squared times the variance of its mean with
+    // the finite population correction
+    double estimate = 0.0;
+    double variance = 0.0;
+    for (
+      unsigned int iStratum = 0;
+      iStratum < that->nbStratum;
+      ++iStratum) {
+
+      if (nbChecked[iStratum] > 0) {
+
+        double nbPathStratum = (double)(that->stratumNbPath[iStratum]);
+        double nbCheckedStratum = (double)(nbChecked[iStratum]);
+        double mean = sums[iStratum] / nbCheckedStratum;
+        estimate += nbPathStratum * mean;
+        double varianceStratum = variancePooled;
+        if (nbChecked[iStratum] > 1) {
+
+          varianceStratum =
+            (sumsSquare[iStratum] - sums[iStratum] * mean) /
+            (nbCheckedStratum - 1.0);
+
+        }
+
+        variance +=
+          nbPathStratum * nbPathStratum *
+          (1.0 - nbCheckedStratum / nbPathStratum) *
+          varianceStratum / nbCheckedStratum;
+
+      }
+
+    }
+
+    // Display the estimation, only for the types of error found in the
+    // sample. The lower bound of the interval is clamped at the number
+    // of errors found in the sample, the total can't be less
+    if (sum > 0.0 || iCol == CBoErrorType_nb) {
+
+      double halfInterval =
+        CBO_SAMPLE_Z95 * sqrt(variance > 0.0 ? variance : 0.0);
+      double low = estimate - halfInterval;
+      if (low < sum) {
+
+        low = sum;
+
+      }
+
+      fprintf(
+        that->stream,
+        "%s : %.1f error(s) in [%.1f, %.1f], %.3f per file\n",
+        (iCol < CBoErrorType_nb ? cboErrorTypeStr[iCol] : "Total"),
+        estimate,
+        low,
+        estimate + halfInterval,
+        (nbPathEstimated > 0 ? estimate / (double)nbPathEstimated : 0.0));
+
+    }
+
+  }
+
+  fflush(that->stream);
+
+  // Free memory
+  free(counts);
+  free(isChecked);
+  free(nbChecked);
+  free(sums);
+  free(sumsSquare);
+
+}
+
+// Create the ring in shared memory through which the child processes
+// checking the files in isolation send their result to the CBo 'that'
+// Return a pointer to the new CBoIsolateRing
+CBoIsolateRing* CBoIsolateRingCreate(const CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Map the ring in memory shared with the child processes
+  CBoIsolateRing* ring =
+    mmap(
+      NULL,
+      sizeof(CBoIsolateRing),
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_ANONYMOUS,
+      -1,
+      0);
+  if (ring == MAP_FAILED) {
+
+    that->err->_type = PBErrTypeMallocFailed;
+    sprintf(
+      that->err->_msg,
+      "Failed to map the ring of the isolated checks");
+    PBErrCatch(that->err);
+
+  }
+
+  // Init the semaphores shared with the child processes
+  sem_init(
+    &(ring->semData),
+    1,
+    0);
+  sem_init(
+    &(ring->semSpace),
+    1,
+    0);
+  ring->head = 0;
+  ring->tail = 0;
+
+  // Return the new ring
+  return ring;
+
+}
+
+// Free the memory used by the CBoIsolateRing 'that'
+void CBoIsolateRingFree(CBoIsolateRing** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Destroy the semaphores and unmap the ring
+  sem_destroy(&((*that)->semData));
+  sem_destroy(&((*that)->semSpace));
+  munmap(
+    *that,
+    sizeof(CBoIsolateRing));
+
+  // Set the pointer to null
+  *that = NULL;
+
+}
+
+// Empty the CBoIsolateRing 'that' before the check of a new file. The
+// semaphores are created again as the previous child process may have
+// been killed while using them
+void CBoIsolateRingReset(CBoIsolateRing* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Reset the semaphores and the positions
+  sem_destroy(&(that->semData));
+  sem_destroy(&(that->semSpace));
+  sem_init(
+    &(that->semData),
+    1,
+    0);
+  sem_init(
+    &(that->semSpace),
+    1,
+    0);
+  that->head = 0;
+  that->tail = 0;
+
+}
+
+// Get in 'time' the absolute time of the clock CLOCK_REALTIME in
+// 'delayMs' milliseconds, but not later than the time 'deadline' of
+// the clock CLOCK_MONOTONIC if it's not NULL
+void CBoGetWaitTime(
+        struct timespec* const time,
+            const unsigned int delayMs,
+  const struct timespec* const deadline) {
+
+#if BUILDMODE == 0
+  if (time == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'time' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the delay in nanoseconds, shortened to the deadline
+  long long delay = (long long)delayMs * 1000000LL;
+  if (deadline != NULL) {
+
+    struct timespec now;
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &now);
+    long long remaining =
+      (long long)(deadline->tv_sec - now.tv_sec) * 1000000000LL +
+      (long long)(deadline->tv_nsec - now.tv_nsec);
+    if (remaining < delay) {
+
+      delay = (remaining > 0 ? remaining : 0);
+
+    }
+
+  }
+
+  // Add the delay to the current time
+  clock_gettime(
+    CLOCK_REALTIME,
+    time);
+  delay += time->tv_nsec;
+  time->tv_sec += (time_t)(delay / 1000000000LL);
+  time->tv_nsec = (long)(delay % 1000000000LL);
+
+}
+
+// Write the 'size' bytes of 'data' in the CBoIsolateRing 'that', from
+// the child process, waiting for the parent process to read them when
+// the ring is full. If the parent process 'parent' ended, end the
+// child process
+void CBoIsolateRingWrite(
+  CBoIsolateRing* const that,
+      const void* const data,
+           const size_t size,
+            const pid_t parent) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (data == NULL && size > 0) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'data' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Loop until all the data are written
+  const char* bytes = data;
+  size_t nbWritten = 0;
+  while (nbWritten < size) {
+
+    // Get the free space in the ring
+    size_t tail =
+      __atomic_load_n(
+        &(that->tail),
+        __ATOMIC_ACQUIRE);
+    size_t space = CBO_ISOLATE_RING_SIZE - (that->head - tail);
+
+    // If the ring is full
+    if (space == 0) {
+
+      // Wait for the parent process to read, and end if it has ended
+      struct timespec time;
+      CBoGetWaitTime(
+        &time,
+        CBO_ISOLATE_POLL_MS,
+        NULL);
+      sem_timedwait(
+        &(that->semSpace),
+        &time);
+      if (getppid() != parent) {
+
+        _exit(EXIT_FAILURE);
+
+      }
+
+    // Else, there is space in the ring
+    } else {
+
+      // Copy as many bytes as possible up to the end of the ring
+      size_t pos = that->head % CBO_ISOLATE_RING_SIZE;
+      size_t nb = size - nbWritten;
+      if (nb > space) {
+
+        nb = space;
+
+      }
+
+      if (nb > CBO_ISOLATE_RING_SIZE - pos) {
+
+        nb = CBO_ISOLATE_RING_SIZE - pos;
+
+      }
+
+      memcpy(
+        that->data + pos,
+        bytes + nbWritten,
+        nb);
+      nbWritten += nb;
+
+      // Publish the bytes to the parent process
+      __atomic_store_n(
+        &(that->head),
+        that->head + nb,
+        __ATOMIC_RELEASE);
+      sem_post(&(that->semData));
+
+    }
+
+  }
+
+}
+
+// Read 'size' bytes from the CBoIsolateRing 'that' into 'data', from
+// the parent process, waiting for the child process 'pid' to write
+// them until the time 'deadline' of the clock CLOCK_MONOTONIC, or with
+// no limit if it's NULL
+// Return true if the bytes were read, false if the child process ended
+// or the deadline passed before
+bool CBoIsolateRingRead(
+         CBoIsolateRing* const that,
+                   void* const data,
+                  const size_t size,
+                   const pid_t pid,
+  const struct timespec* const deadline) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (data == NULL && size > 0) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'data' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Loop until all the data are read
+  char* bytes = data;
+  size_t nbRead = 0;
+  bool isEnded = false;
+  while (nbRead < size) {
+
+    // Get the number of bytes available in the ring
+    size_t head =
+      __atomic_load_n(
+        &(that->head),
+        __ATOMIC_ACQUIRE);
+    size_t nbAvailable = head - that->tail;
+
+    // If there is no data and the child process has ended, or the
+    // deadline has passed, the data will never come
+    if (nbAvailable == 0 && isEnded == true) {
+
+      return false;
+
+    }
+
+    // If there is no data
+    if (nbAvailable == 0) {
+
+      // Wait for the child process to write, no more than the poll
+      // delay to check if it has ended
+      struct timespec time;
+      CBoGetWaitTime(
+        &time,
+        CBO_ISOLATE_POLL_MS,
+        deadline);
+      sem_timedwait(
+        &(that->semData),
+        &time);
+
+      // Check if the child process has ended, without reaping it, the
+      // data it wrote before ending are read before giving up
+      siginfo_t info;
+      info.si_pid = 0;
+      waitid(
+        P_PID,
+        (id_t)pid,
+        &info,
+        WEXITED | WNOHANG | WNOWAIT);
+      isEnded = (info.si_pid == pid);
+
+      // Check the deadline
+      if (deadline != NULL) {
+
+        struct timespec now;
+        clock_gettime(
+          CLOCK_MONOTONIC,
+          &now);
+        if (
+          now.tv_sec > deadline->tv_sec ||
+          (now.tv_sec == deadline->tv_sec &&
+          now.tv_nsec >= deadline->tv_nsec)) {
+
+          isEnded = true;
+
+        }
+
+      }
+
+    // Else, there are data in the ring
+    } else {
+
+      // Copy as many bytes as possible up to the end of the ring
+      size_t pos = that->tail % CBO_ISOLATE_RING_SIZE;
+      size_t nb = size - nbRead;
+      if (nb > nbAvailable) {
+
+        nb = nbAvailable;
+
+      }
+
+      if (nb > CBO_ISOLATE_RING_SIZE - pos) {
+
+        nb = CBO_ISOLATE_RING_SIZE - pos;
+
+      }
+
+      memcpy(
+        bytes + nbRead,
+        that->data + pos,
+        nb);
+      nbRead += nb;
+
+      // Give back the space to the child process
+      __atomic_store_n(
+        &(that->tail),
+        that->tail + nb,
+        __ATOMIC_RELEASE);
+      sem_post(&(that->semSpace));
+
+    }
+
+  }
+
+  // Return the success flag
+  return true;
+
+}
+
+// Check the CBoFile 'that' with the CBo 'cbo' in a child process, which
+// sends its errors and its output through the CBoIsolateRing 'ring'.
+// If the child process ends abnormally or doesn't end before the time
+// budget of the CBo, it's killed and the file is reported as aborted.
+// The errors of the file are displayed on the stream of the CBo
+// Return true if the file is correct, else false
+bool CBoFileCheckIsolated(
+         CBoFile* const that,
+             CBo* const cbo,
+  CBoIsolateRing* const ring) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (ring == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'ring' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the deadline of the check, with the default time budget if
+  // there is no timeout. The child process is forked from a thread of
+  // a multithreaded process, only the forking thread is copied, so a
+  // lock held by another thread (by malloc or stdio for example) stays
+  // locked in the child process, the deadline ensures the parent
+  // process doesn't wait forever for such a child process
+  unsigned int timeoutMs = cbo->timeoutMs;
+  if (timeoutMs == 0) {
+
+    timeoutMs = CBO_ISOLATE_TIMEOUT_MS;
+
+  }
+
+  struct timespec deadline;
+  clock_gettime(
+    CLOCK_MONOTONIC,
+    &deadline);
+  long long nsec =
+    (long long)deadline.tv_nsec + (long long)timeoutMs * 1000000LL;
+  deadline.tv_sec += (time_t)(nsec / 1000000000LL);
+  deadline.tv_nsec = (long)(nsec % 1000000000LL);
+
+  // Create the child process checking the file
+  CBoIsolateRingReset(ring);
+  if (cbo->stream != NULL) {
+
+    fflush(cbo->stream);
+
+  }
+
+  pid_t parent = getpid();
+  pid_t pid = fork();
+
+  // If we couldn't create the child process, check the file in this
+  // process
+  if (pid < 0) {
+
+    bool correct =
+      CBoFileCheck(
+        that,
+        cbo);
+    if (
+      correct == false &&
+      cbo->flagListFileError == false &&
+      cbo->format == CBoFormat_text) {
+
+      CBoFilePrintErrors(
+        that,
+        cbo);
+
+    }
+
+    return correct;
+
+  }
+
+  // If we are the child process
+  if (pid == 0) {
+
+    // Check the file and get its output, in the copy of the output
+    // stream of the parent process
+    CBoIsolateHeader header;
+    header.isCorrect =
+      CBoFileCheck(
+        that,
+        cbo);
+    if (
+      header.isCorrect == false &&
+      cbo->flagListFileError == false &&
+      cbo->format == CBoFormat_text) {
+
+      CBoFilePrintErrors(
+        that,
+        cbo);
+
+    }
+
+    if (cbo->stream != NULL) {
+
+      fclose(cbo->stream);
+
+    }
+
+    // Send the result, the errors and the output of the file
+    header.nbError = GSetNbElem(&(that->errors));
+    header.outputSize = that->outputSize;
+    CBoIsolateRingWrite(
+      ring,
+      &header,
+      sizeof(CBoIsolateHeader),
+      parent);
+    if (header.nbError > 0) {
+
+      GSetIterForward iter = GSetIterForwardCreateStatic(&(that->errors));
+      do {
+
+        const CBoError* error = GSetIterGet(&iter);
+        CBoIsolateError isolateError;
+        isolateError.iLine = error->iLine;
+        isolateError.type = error->type;
+        CBoIsolateRingWrite(
+          ring,
+          &isolateError,
+          sizeof(CBoIsolateError),
+          parent);
+
+      } while (GSetIterStep(&iter) == true);
+
+    }
+
+    CBoIsolateRingWrite(
+      ring,
+      that->output,
+      that->outputSize,
+      parent);
+
+    // End the child process, without flushing the streams inherited
+    // from the parent process
+    _exit(EXIT_SUCCESS);
+
+  }
+
+  // Receive the result of the check
+  const struct timespec* limit = &deadline;
+  CBoIsolateHeader header;
+  bool isReceived =
+    CBoIsolateRingRead(
+      ring,
+      &header,
+      sizeof(CBoIsolateHeader),
+      pid,
+      limit);
+
+  // Receive the errors, and add them to the file
+  for (
+    unsigned int iError = 0;
+    isReceived == true && iError < header.nbError;
+    ++iError) {
+
+    CBoIsolateError isolateError;
+    isReceived =
+      CBoIsolateRingRead(
+        ring,
+        &isolateError,
+        sizeof(CBoIsolateError),
+        pid,
+        limit);
+    if (isReceived == true) {
+
+      CBoLine* line = NULL;
+      if (
+        isolateError.iLine > 0 &&
+        isolateError.iLine <= GSetNbElem(&(that->lines))) {
+
+        line = that->lineArr[isolateError.iLine - 1];
+
+      }
+
+      CBoError* error =
+        CBoErrorCreate(
+          that,
+          line,
+          isolateError.iLine,
+          isolateError.type);
+      CBoFileAddError(
+        that,
+        error);
+
+    }
+
+  }
+
+  // Receive the output of the check, and display it on the stream of
+  // the CBo
+  if (isReceived == true && header.outputSize > 0) {
+
+    char* output =
+      PBErrMalloc(
+        cbo->err,
+        header.outputSize);
+    isReceived =
+      CBoIsolateRingRead(
+        ring,
+        output,
+        header.outputSize,
+        pid,
+        limit);
+    if (isReceived == true && cbo->stream != NULL) {
+
+      fwrite(
+        output,
+        1,
+        header.outputSize,
+        cbo->stream);
+
+    }
+
+    free(output);
+
+  }
+
+  // If the result is incomplete, kill the child process, which does
+  // nothing if it has already ended
+  if (isReceived == false) {
+
+    kill(
+      pid,
+      SIGKILL);
+
+  }
+
+  // Wait for the end of the child process
+  int status = 0;
+  waitpid(
+    pid,
+    &status,
+    0);
+
+  // If the result is incomplete, the check of the file is aborted
+  if (isReceived == false) {
+
+    // Discard the errors already received
+    while (GSetNbElem(&(that->errors)) > 0) {
+
+      CBoError* error = GSetPop(&(that->errors));
+      CBoErrorFree(&error);
+
+    }
+
+    // Display the reason of the abort, if the output is displayed
+    that->isAborted = true;
+    struct timespec now;
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &now);
+    bool isTimedOut =
+      (now.tv_sec > deadline.tv_sec ||
+      (now.tv_sec == deadline.tv_sec &&
+      now.tv_nsec >= deadline.tv_nsec));
+    if (cbo->stream != NULL && isTimedOut == true) {
+
+      fprintf(
+        cbo->stream,
+        "\nThe check of [%s] was aborted after %u ms\n",
+        that->filePath,
+        timeoutMs);
+
+    } else if (cbo->stream != NULL && WIFSIGNALED(status)) {
+
+      fprintf(
+        cbo->stream,
+        "\nThe check of [%s] was aborted by the signal %d\n",
+        that->filePath,
+        WTERMSIG(status));
+
+    } else if (cbo->stream != NULL) {
+
+      fprintf(
+        cbo->stream,
+        "\nThe check of [%s] was aborted\n",
+        that->filePath);
+
+    }
+
+    return false;
+
+  }
+
+  // Return the result of the check
+  return header.isCorrect;
+
+}
+
+// Create the progress reporter of the check of the 'nbFile' files of
+// the CBo 'that'. The progress is displayed only if the stream of the
+// CBo is a terminal
+// Return a pointer to the new CBoProgress, or NULL if the progress is
+// not displayed
+CBoProgress* CBoProgressCreate(
+    const CBo* const that,
+  const unsigned int nbFile) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the stream is not a terminal, or is read by another tool, there
+  // is no progress to display
+  if (
+    that->flagWorker == true ||
+    that->format != CBoFormat_text ||
+    isatty(fileno(that->stream)) == 0) {
+
+    return NULL;
+
+  }
+
+  // Allocate memory for the progress reporter
+  CBoProgress* progress =
+    PBErrMalloc(
+      that->err,
+      sizeof(CBoProgress));
+
+  // Init the properties
+  progress->stream = that->stream;
+  progress->nbFile = nbFile;
+  progress->nbFileChecked = 0;
+  progress->path = NULL;
+  progress->rule = NULL;
+  progress->permille = 0;
+  progress->isDrawn = false;
+  clock_gettime(
+    CLOCK_MONOTONIC,
+    &(progress->lastDraw));
+
+  // Return the new progress reporter
+  return progress;
+
+}
+
+// Free the memory used by the CBoProgress 'that'
+void CBoProgressFree(CBoProgress** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Free the memory
+  free(*that);
+
+  // Set the pointer to null
+  *that = NULL;
+
+}
+
+// Memorize in the CBoProgress 'that' the start of the check of the file
+// at 'path'
+void CBoProgressSetFile(
+  CBoProgress* const that,
+   const char* const path) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Memorize the file, the thread displaying the progress reads it
+  // concurrently
+  __atomic_store_n(
+    &(that->path),
+    path,
+    __ATOMIC_RELAXED);
+
+}
+
+// Memorize in the CBoProgress 'that' the end of the check of a file
+void CBoProgressEndFile(CBoProgress* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Update the number of checked files
+  __atomic_fetch_add(
+    &(that->nbFileChecked),
+    1,
+    __ATOMIC_RELAXED);
+
+}
+
+// Memorize in the CBoProgress 'that' the progress of the check of the
+// rule 'rule', at the step 'iStep' out of 'nbStep'. It's called before
+// the check of each rule of a file, it doesn't display anything
+void CBoProgressSetRule(
+  CBoProgress* const that,
+   const char* const rule,
+  const unsigned int iStep,
+  const unsigned int nbStep) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Memorize the rule and its progress
+  __atomic_store_n(
+    &(that->rule),
+    rule,
+    __ATOMIC_RELAXED);
+  unsigned int permille =
+    (nbStep > 0 ? (unsigned int)((uint64_t)iStep * 1000 / nbStep) : 0);
+  __atomic_store_n(
+    &(that->permille),
+    permille,
+    __ATOMIC_RELAXED);
+
+}
+
+// Display the CBoProgress 'that' on its terminal, if it hasn't been
+// displayed for CBO_PROGRESS_DELAY_MS milliseconds. Only the thread
+// displaying the reports of the files calls it, so the progress never
+// interleaves with the reports
+void CBoProgressDraw(CBoProgress* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the progress was displayed recently, do nothing
+  struct timespec now;
+  clock_gettime(
+    CLOCK_MONOTONIC,
+    &now);
+  long long elapsedMs =
+    (long long)(now.tv_sec - that->lastDraw.tv_sec) * 1000LL +
+    (long long)(now.tv_nsec - that->lastDraw.tv_nsec) / 1000000LL;
+  if (elapsedMs < CBO_PROGRESS_DELAY_MS) {
+
+    return;
+
+  }
+
+  that->lastDraw = now;
+
+  // Get the progress
+  unsigned int nbFileChecked =
+    __atomic_load_n(
+      &(that->nbFileChecked),
+      __ATOMIC_RELAXED);
+  const char* path =
+    __atomic_load_n(
+      &(that->path),
+      __ATOMIC_RELAXED);
+  const char* rule =
+    __atomic_load_n(
+      &(that->rule),
+      __ATOMIC_RELAXED);
+  unsigned int permille =
+    __atomic_load_n(
+      &(that->permille),
+      __ATOMIC_RELAXED);
+  ProgBarTxt progBar = ProgBarTxtCreateStatic();
+  ProgBarTxtSet(
+    &progBar,
+    (float)permille / 1000.0);
+
+  // Display the progress on one line of the terminal, overwriting the
+  // previous one, the rule and the file only once a check has started
+  char line[CBO_PROGRESS_WIDTH + 1];
+  if (
+    rule != NULL &&
+    path != NULL) {
+
+    snprintf(
+      line,
+      sizeof(line),
+      "%u/%u %s %s %s",
+      nbFileChecked,
+      that->nbFile,
+      rule,
+      ProgBarTxtGet(&progBar),
+      path);
+
+  } else {
+
+    snprintf(
+      line,
+      sizeof(line),
+      "%u/%u",
+      nbFileChecked,
+      that->nbFile);
+
+  }
+
+  fprintf(
+    that->stream,
+    "\r%s\033[K",
+    line);
+  fflush(that->stream);
+  that->isDrawn = true;
+
+}
+
+// Erase the CBoProgress 'that' from its terminal, before displaying a
+// report
+void CBoProgressClear(CBoProgress* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the progress is displayed, erase its line
+  if (that->isDrawn == true) {
+
+    fprintf(
+      that->stream,
+      "\r\033[K");
+    fflush(that->stream);
+    that->isDrawn = false;
+
+  }
+
+}
+
+// Print on the stream 'stream' the string 'str' as a JSON string,
+// between quotes and with its special characters escaped, without
+// allocating memory
+void CBoPrintJsonString(
+        FILE* const stream,
+  const char* const str) {
+
+#if BUILDMODE == 0
+  if (stream == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'stream' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (str == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'str' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Loop on the characters, printing the runs of characters which
+  // don't need escaping at once
+  fputc(
+    '"',
+    stream);
+  const char* run = str;
+  const char* ptr = str;
+  while (*ptr != '\0') {
+
+    unsigned char c = (unsigned char)(*ptr);
+    if (
+      c == '"' ||
+      c == '\\' ||
+      c < 0x20) {
+
+      fwrite(
+        run,
+        1,
+        ptr - run,
+        stream);
+      if (c == '"' || c == '\\') {
+
+        fputc(
+          '\\',
+          stream);
+        fputc(
+          c,
+          stream);
+
+      } else if (c == '\t') {
+
+        fputs(
+          "\\t",
+          stream);
+
+      } else {
+
+        fprintf(
+          stream,
+          "\\u%04x",
+          c);
+
+      }
+
+      run = ptr + 1;
+
+    }
+
+    ++ptr;
+
+  }
+
+  fwrite(
+    run,
+    1,
+    ptr - run,
+    stream);
+  fputc(
+    '"',
+    stream);
+
+}
+
+// Print on the stream 'stream' the head of the records of the file at
+// 'path', in the format of the CBo 'that'. In binary format it's the
+// path, moved to the index of the paths by CBoWriteReport
+void CBoPrintRecordsHead(
+  const CBo* const that,
+       FILE* const stream,
+ const char* const path) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (stream == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'stream' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (path == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'path' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the format is binary, print the length of the path followed by
+  // the path
+  if (that->format == CBoFormat_binary) {
+
+    uint32_t length = (uint32_t)strlen(path);
+    fwrite(
+      &length,
+      sizeof(length),
+      1,
+      stream);
+    fwrite(
+      path,
+      1,
+      length,
+      stream);
+
+  }
+
+}
+
+// Print on the stream 'stream' the record of a problem of the file at
+// 'path', at the line 'iLine' (0 if it concerns the whole file), of
+// the rule 'rule' (a CBoErrorType, CBO_RULE_LOAD_FAILED or
+// CBO_RULE_CHECK_ABORTED), whose line content has the hash 'lineHash',
+// in the format of the CBo 'that'. In SARIF format the record is a
+// result preceded by a comma, see CBoWriteReport
+void CBoPrintRecord(
+    const CBo* const that,
+         FILE* const stream,
+   const char* const path,
+  const unsigned int iLine,
+  const unsigned int rule,
+      const uint32_t lineHash) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (stream == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'stream' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (rule >= CBO_NB_RULE) {
+
+    CBoErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      CBoErr->_msg,
+      "'rule' is invalid (%u>=%d)",
+      rule,
+      CBO_NB_RULE);
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the identifier and the description of the rule
+  const char* ruleId = NULL;
+  const char* message = NULL;
+  if (rule < CBoErrorType_nb) {
+
+    ruleId = cboErrorTypeId[rule];
+    message = cboErrorTypeStr[rule];
+
+  } else {
+
+    ruleId = cboFileRuleId[rule - CBoErrorType_nb];
+    message = cboFileRuleStr[rule - CBoErrorType_nb];
+
+  }
+
+  // If the format is text, print the record on one line, the line only
+  // if it's known
+  if (that->format == CBoFormat_text) {
+
+    if (iLine > 0) {
+
+      fprintf(
+        stream,
+        "%s:%u: %s [%s]\n",
+        path,
+        iLine,
+        message,
+        ruleId);
+
+    } else {
+
+      fprintf(
+        stream,
+        "%s: %s [%s]\n",
+        path,
+        message,
+        ruleId);
+
+    }
+
+  // Else, if the format is JSON Lines
+  } else if (that->format == CBoFormat_jsonl) {
+
+    // Print the record on one line
+    fputs(
+      "{\"path\":",
+      stream);
+    CBoPrintJsonString(
+      stream,
+      path);
+    fprintf(
+      stream,
+      ",\"line\":%u,\"rule\":",
+      iLine);
+    CBoPrintJsonString(
+      stream,
+      ruleId);
+    fputs(
+      ",\"message\":",
+      stream);
+    CBoPrintJsonString(
+      stream,
+      message);
+    fputs(
+      "}\n",
+      stream);
+
+  // Else, if the format is SARIF
+  } else if (that->format == CBoFormat_sarif) {
+
+    // Print the result, the region only if the line is known
+    fputs(
+      ",\n{\"ruleId\":",
+      stream);
+    CBoPrintJsonString(
+      stream,
+      ruleId);
+    fputs(
+      ",\"level\":\"error\",\"message\":{\"text\":",
+      stream);
+    CBoPrintJsonString(
+      stream,
+      message);
+    fputs(
+      "},\"locations\":[{\"physicalLocation\":{\"artifactLocation\":"
+      "{\"uri\":",
+      stream);
+    CBoPrintJsonString(
+      stream,
+      path);
+    fputc(
+      '}',
+      stream);
+    if (iLine > 0) {
+
+      fprintf(
+        stream,
+        ",\"region\":{\"startLine\":%u}",
+        iLine);
+
+    }
+
+    fputs(
+      "}}]}",
+      stream);
+
+  // Else, the format is binary
+  } else {
+
+    // Print the record, the index of the file is set by CBoWriteReport
+    CBoBinaryRecord record;
+    record.iFile = 0;
+    record.iLine = iLine;
+    record.rule = rule;
+    record.lineHash = lineHash;
+    fwrite(
+      &record,
+      sizeof(record),
+      1,
+      stream);
+
+  }
+
+}
+
+// Print the records of the errors of the CBoFile 'that' on the stream
+// of the CBo 'cbo', in its format. An aborted check gives one record
+// for the whole file
+void CBoFilePrintRecords(
+  const CBoFile* const that,
+      const CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Print the head of the records
+  CBoPrintRecordsHead(
+    cbo,
+    cbo->stream,
+    that->filePath);
+
+  // If the check was aborted
+  if (that->isAborted == true) {
+
+    CBoPrintRecord(
+      cbo,
+      cbo->stream,
+      that->filePath,
+      0,
+      CBO_RULE_CHECK_ABORTED,
+      0);
+
+  }
+
+  // Loop on the errors
+  if (GSetNbElem(&(that->errors)) > 0) {
+
+    GSetIterForward iter = GSetIterForwardCreateStatic(&(that->errors));
+    do {
+
+      // Hash the content of the line of the error, only needed in
+      // binary format
+      const CBoError* error = GSetIterGet(&iter);
+      uint32_t lineHash = 0;
+      if (cbo->format == CBoFormat_binary) {
+
+        lineHash =
+          CBoFileGetLineHash(
+            that,
+            error->iLine);
+
+      }
+
+      CBoPrintRecord(
+        cbo,
+        cbo->stream,
+        that->filePath,
+        error->iLine,
+        error->type,
+        lineHash);
+
+    } while (GSetIterStep(&iter) == true);
+
+  }
+
+}
+
+// Write the 'size' bytes of the 'report' of a file on the stream of the
+// CBo 'that'. In SARIF format, each result is preceded by a comma,
+// which is skipped for the first result of the document
+void CBoWriteReport(
+         CBo* const that,
+  const char* const report,
+       const size_t size) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the format is binary, the report is not written as it is
+  if (that->format == CBoFormat_binary) {
+
+    CBoWriteBinaryReport(
+      that,
+      report,
+      size);
+
+  // Else, write the report
+  } else {
+
+    // Skip the comma before the first result
+    size_t skip = 0;
+    if (
+      that->format == CBoFormat_sarif &&
+      that->flagResultWritten == false &&
+      size > 0 &&
+      report[0] == ',') {
+
+      skip = 1;
+      that->flagResultWritten = true;
+
+    }
+
+    // Write the report
+    if (size > skip) {
+
+      fwrite(
+        report + skip,
+        1,
+        size - skip,
+        that->stream);
+      fflush(that->stream);
+
+    }
+
+  }
+
+}
+
+// Write the 'size' bytes of the binary 'report' of a file on the stream
+// of the CBo 'that': memorize its path in the index of the paths and
+// write its records with the index of the file
+void CBoWriteBinaryReport(
+         CBo* const that,
+  const char* const report,
+       const size_t size) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the length of the path at the head of the report
+  uint32_t length = 0;
+  if (size >= sizeof(length)) {
+
+    memcpy(
+      &length,
+      report,
+      sizeof(length));
+
+  }
+
+  // Check the report is made of the path and whole records
+  if (
+    size < sizeof(length) ||
+    length > size - sizeof(length) ||
+    (size - sizeof(length) - length) % sizeof(CBoBinaryRecord) != 0) {
+
+    that->err->_type = PBErrTypeInvalidArg;
+    sprintf(
+      that->err->_msg,
+      "Invalid binary report (%zu bytes)",
+      size);
+    PBErrCatch(that->err);
+
+  }
+
+  // Memorize the path in the index of the paths
+  char* path =
+    PBErrMalloc(
+      that->err,
+      length + 1);
+  memcpy(
+    path,
+    report + sizeof(length),
+    length);
+  path[length] = '\0';
+  uint32_t iFile = GSetNbElem(&(that->binaryPaths));
+  GSetAppend(
+    &(that->binaryPaths),
+    path);
+
+  // Loop on the records
+  for (
+    size_t offset = sizeof(length) + length;
+    offset < size;
+    offset += sizeof(CBoBinaryRecord)) {
+
+    // Write the record with the index of the file
+    CBoBinaryRecord record;
+    memcpy(
+      &record,
+      report + offset,
+      sizeof(record));
+    record.iFile = iFile;
+    fwrite(
+      &record,
+      sizeof(record),
+      1,
+      that->stream);
+    ++(that->nbBinaryRecord);
+
+  }
+
+  fflush(that->stream);
+
+}
+
+// Print on the stream of the CBo 'that' the head of the output: in
+// SARIF format the head of the document up to the opening of the array
+// of results, in binary format the CBoBinaryHead. The records are then
+// printed as the files are checked
+void CBoPrintOutputHead(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the format is SARIF
+  if (that->format == CBoFormat_sarif) {
+
+    // Print the description of the tool and its rules
+    fputs(
+      "{\"version\":\"2.1.0\",\"$schema\":"
+      "\"https://json.schemastore.org/sarif-2.1.0.json\",\"runs\":[\n"
+      "{\"tool\":{\"driver\":{\"name\":\"CBo\",\"rules\":[",
+      that->stream);
+    for (
+      unsigned int iType = 0;
+      iType < CBoErrorType_nb;
+      ++iType) {
+
+      fputs(
+        (iType > 0 ? ",\n{\"id\":" : "\n{\"id\":"),
+        that->stream);
+      CBoPrintJsonString(
+        that->stream,
+        cboErrorTypeId[iType]);
+      fputs(
+        ",\"shortDescription\":{\"text\":",
+        that->stream);
+      CBoPrintJsonString(
+        that->stream,
+        cboErrorTypeStr[iType]);
+      fputs(
+        "}}",
+        that->stream);
+
+    }
+
+    fputs(
+      "]}},\"results\":[\n",
+      that->stream);
+    fflush(that->stream);
+    that->flagResultWritten = false;
+
+  // Else, if the format is binary
+  } else if (that->format == CBoFormat_binary) {
+
+    // Print the head
+    CBoBinaryHead head;
+    memset(
+      &head,
+      0,
+      sizeof(head));
+    memcpy(
+      head.magic,
+      CBO_BINARY_MAGIC,
+      sizeof(head.magic));
+    head.version = CBO_BINARY_VERSION;
+    head.recordSize = sizeof(CBoBinaryRecord);
+    fwrite(
+      &head,
+      sizeof(head),
+      1,
+      that->stream);
+    fflush(that->stream);
+
+    // Reset the index of the paths and the number of records
+    while (GSetNbElem(&(that->binaryPaths)) > 0) {
+
+      char* path = GSetPop(&(that->binaryPaths));
+      free(path);
+
+    }
+
+    that->nbBinaryRecord = 0;
+
+  }
+
+}
+
+// Print on the stream of the CBo 'that' the tail of the output: in
+// SARIF format the closing of the array of results, in binary format
+// the index of the paths, the paths and the CBoBinaryTail
+void CBoPrintOutputTail(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the format is SARIF
+  if (that->format == CBoFormat_sarif) {
+
+    // Close the results, the run and the document
+    fputs(
+      "\n]}]}\n",
+      that->stream);
+    fflush(that->stream);
+
+  // Else, if the format is binary
+  } else if (that->format == CBoFormat_binary) {
+
+    // Print the index of the paths, then the paths
+    uint32_t offset = 0;
+    if (GSetNbElem(&(that->binaryPaths)) > 0) {
+
+      GSetIterForward iter =
+        GSetIterForwardCreateStatic(&(that->binaryPaths));
+      do {
+
+        const char* path = GSetIterGet(&iter);
+        fwrite(
+          &offset,
+          sizeof(offset),
+          1,
+          that->stream);
+        offset += (uint32_t)strlen(path) + 1;
+
+      } while (GSetIterStep(&iter) == true);
+
+      iter = GSetIterForwardCreateStatic(&(that->binaryPaths));
+      do {
+
+        const char* path = GSetIterGet(&iter);
+        fwrite(
+          path,
+          1,
+          strlen(path) + 1,
+          that->stream);
+
+      } while (GSetIterStep(&iter) == true);
+
+    }
+
+    // Print the tail
+    CBoBinaryTail tail;
+    memset(
+      &tail,
+      0,
+      sizeof(tail));
+    tail.pathsOffset =
+      sizeof(CBoBinaryHead) +
+      (uint64_t)(that->nbBinaryRecord) * sizeof(CBoBinaryRecord);
+    tail.nbFile = GSetNbElem(&(that->binaryPaths));
+    tail.nbRecord = that->nbBinaryRecord;
+    memcpy(
+      tail.magic,
+      CBO_BINARY_MAGIC,
+      sizeof(tail.magic));
+    fwrite(
+      &tail,
+      sizeof(tail),
+      1,
+      that->stream);
+    fflush(that->stream);
+
+  }
+
+}
+
+// Render in the format of the CBo 'that' the binary result at 'path',
+// read from a mapping of the file, and add its totals to the ones of
+// 'that'. Set 'isValid' to false if the binary result is invalid
+// Return true if the binary result has no record, else false
+bool CBoRenderBinaryResult(
+         CBo* const that,
+  const char* const path,
+        bool* const isValid) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (path == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'path' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (isValid == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'isValid' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Map the binary result in memory, the mapping stays valid once the
+  // file is closed
+  const char* data = NULL;
+  size_t size = 0;
+  FILE* fp =
+    fopen(
+      path,
+      "r");
+  if (fp != NULL) {
+
+    struct stat status;
+    if (
+      fstat(
+        fileno(fp),
+        &status) == 0 &&
+      status.st_size > 0) {
+
+      size = (size_t)(status.st_size);
+      void* map =
+        mmap(
+          NULL,
+          size,
+          PROT_READ,
+          MAP_PRIVATE,
+          fileno(fp),
+          0);
+      if (map != MAP_FAILED) {
+
+        data = map;
+
+      }
+
+    }
+
+    fclose(fp);
+
+  }
+
+  // Check the head and the tail. The index of the paths is followed by
+  // the null terminated paths
+  CBoBinaryHead head;
+  CBoBinaryTail tail;
+  bool success =
+    (data != NULL &&
+    size >= sizeof(head) + sizeof(tail));
+  if (success == true) {
+
+    memcpy(
+      &head,
+      data,
+      sizeof(head));
+    memcpy(
+      &tail,
+      data + size - sizeof(tail),
+      sizeof(tail));
+    success =
+      (memcmp(
+        head.magic,
+        CBO_BINARY_MAGIC,
+        sizeof(head.magic)) == 0 &&
+      memcmp(
+        tail.magic,
+        CBO_BINARY_MAGIC,
+        sizeof(tail.magic)) == 0 &&
+      head.version == CBO_BINARY_VERSION &&
+      head.recordSize == sizeof(CBoBinaryRecord) &&
+      tail.pathsOffset ==
+        sizeof(head) +
+        (uint64_t)(tail.nbRecord) * sizeof(CBoBinaryRecord) &&
+      tail.pathsOffset + (uint64_t)(tail.nbFile) * sizeof(uint32_t) <=
+        size - sizeof(tail));
+
+  }
+
+  const char* paths = NULL;
+  size_t pathsSize = 0;
+  if (success == true) {
+
+    paths =
+      data + tail.pathsOffset + (size_t)(tail.nbFile) * sizeof(uint32_t);
+    pathsSize = (size_t)(data + size - sizeof(tail) - paths);
+    success =
+      (tail.nbFile == 0 ||
+      (pathsSize > 0 && paths[pathsSize - 1] == '\0'));
+
+  }
+
+  // Loop on the files, their records are consecutive in the order of
+  // the files, and the records and the index are aligned in the mapping
+  unsigned int nbRecord = 0;
+  if (success == true) {
+
+    const CBoBinaryRecord* records =
+      (const CBoBinaryRecord*)(data + sizeof(head));
+    const uint32_t* pathOffsets =
+      (const uint32_t*)(data + tail.pathsOffset);
+    uint32_t iRecord = 0;
+    for (
+      uint32_t iFile = 0;
+      iFile < tail.nbFile &&
+      success == true;
+      ++iFile) {
+
+      // Get the path of the file
+      success = (pathOffsets[iFile] < pathsSize);
+      const char* filePath = paths + pathOffsets[iFile];
+
+      // Render the records of the file in a buffer, as the report of a
+      // checked file
+      char* report = NULL;
+      size_t reportSize = 0;
+      FILE* stream = NULL;
+      if (success == true) {
+
+        stream =
+          open_memstream(
+            &report,
+            &reportSize);
+        if (stream == NULL) {
+
+          that->err->_type = PBErrTypeIOError;
+          sprintf(
+            that->err->_msg,
+            "Failed to open the report stream of [%s]",
+            filePath);
+          PBErrCatch(that->err);
+
+        }
+
+        CBoPrintRecordsHead(
+          that,
+          stream,
+          filePath);
+
+      }
+
+      bool hasError = false;
+      while (
+        success == true &&
+        iRecord < tail.nbRecord &&
+        records[iRecord].iFile == iFile) {
+
+        // Render the record and count it as a checked run would: an
+        // aborted check makes a file with error without error, and a
+        // file which couldn't be loaded has no error
+        const CBoBinaryRecord* record = records + iRecord;
+        success = (record->rule < CBO_NB_RULE);
+        if (success == true) {
+
+          CBoPrintRecord(
+            that,
+            stream,
+            filePath,
+            record->iLine,
+            record->rule,
+            record->lineHash);
+          hasError |= (record->rule != CBO_RULE_LOAD_FAILED);
+          if (record->rule < CBoErrorType_nb) {
+
+            ++(that->nbMergedError);
+
+          }
+
+        }
+
+        ++iRecord;
+
+      }
+
+      // Display the report of the file
+      if (stream != NULL) {
+
+        fclose(stream);
+        if (success == true) {
+
+          CBoWriteReport(
+            that,
+            report,
+            reportSize);
+
+        }
+
+        free(report);
+
+      }
+
+      // Update the totals
+      ++(that->nbMergedFile);
+      if (hasError == true) {
+
+        ++(that->nbMergedFileWithError);
+
+      }
+
+    }
+
+    // All the records must belong to a file
+    success &= (iRecord == tail.nbRecord);
+    nbRecord = tail.nbRecord;
+
+  }
+
+  // Unmap the binary result
+  if (data != NULL) {
+
+    munmap(
+      (void*)data,
+      size);
+
+  }
+
+  // If the binary result is invalid, display a message
+  if (success == false) {
+
+    fprintf(
+      that->stream,
+      "The binary result [%s] is invalid\n",
+      path);
+    *isValid = false;
+
+  }
+
+  // Return true if there was no record
+  return (nbRecord == 0);
+
+}
+
+// Render in the format of the CBo 'that' the binary results whose paths
+// are the paths of 'that', and memorize their totals
+// Return true if the binary results are valid and have no record, else
+// false
+bool CBoRenderBinaryResults(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Reset the totals
+  that->nbMergedFile = 0;
+  that->nbMergedFileWithError = 0;
+  that->nbMergedError = 0;
+  that->flagInvalidResult = false;
+
+  // Loop on the binary results
+  bool isValid = true;
+  bool isCorrect = true;
+  if (GSetNbElem(&(that->filePaths)) > 0) {
+
+    GSetIterForward iter = GSetIterForwardCreateStatic(&(that->filePaths));
+    do {
+
+      isCorrect &=
+        CBoRenderBinaryResult(
+          that,
+          GSetIterGet(&iter),
+          &isValid);
+
+    } while (GSetIterStep(&iter) == true);
+
+  }
+
+  // Memorize if one of the binary results is invalid
+  that->flagInvalidResult = (isValid == false);
+
+  // Return the success flag
+  return isValid & isCorrect;
+
+}
+
+// Calculate the hash of the content of the line 'iLine' (starting at
+// 1) of the CBoFile 'that', folded to 32 bits
+// Return the hash, 0 if the line doesn't exist
+uint32_t CBoFileGetLineHash(
+  const CBoFile* const that,
+    const unsigned int iLine) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the line doesn't exist, or the lines have been freed
+  if (
+    that->lineArr == NULL ||
+    iLine == 0 ||
+    iLine > GSetNbElem(&(that->lines))) {
+
+    return 0;
+
+  }
+
+  // Hash the line and fold the 64 bits hash
+  const char* str = that->lineArr[iLine - 1]->str;
+  uint64_t hash =
+    CBoHashFNV1a(
+      str,
+      (unsigned int)strlen(str));
+  return (uint32_t)(hash ^ (hash >> 32));
+
+}
+
+// Calculate the key in the baseline of the error of rule 'ruleId' in
+// the file at 'path', whose line content has the hash 'lineHash', and
+// which is the 'occurrence'-th error of the file with this rule and
+// this line content
+// Return the key, never 0
+uint64_t CBoBaselineGetKey(
+   const char* const path,
+   const char* const ruleId,
+      const uint32_t lineHash,
+  const unsigned int occurrence) {
+
+#if BUILDMODE == 0
+  if (path == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'path' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (ruleId == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'ruleId' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Hash the path and the rule, and mix in the line hash and the
+  // occurrence
+  uint64_t key =
+    CBoHashFNV1a(
+      path,
+      (unsigned int)strlen(path));
+  key ^=
+    CBoHashFNV1a(
+      ruleId,
+      (unsigned int)strlen(ruleId));
+  key *= CBO_FNV1A_PRIME;
+  key ^= lineHash;
+  key *= CBO_FNV1A_PRIME;
+  key ^= occurrence;
+  key *= CBO_FNV1A_PRIME;
+
+  // 0 marks the empty slots of the baseline
+  if (key == 0) {
+
+    key = 1;
+
+  }
+
+  // Return the key
+  return key;
+
+}
+
+// Function to create a new empty CBoBaseline, for the CBo 'cbo' whose
+// error state it uses
+// Return a pointer to the new CBoBaseline
+CBoBaseline* CBoBaselineCreate(const CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Allocate memory for the baseline
+  CBoBaseline* that =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(CBoBaseline));
+
+  // Init the properties, all the slots are empty
+  that->err = cbo->err;
+  that->nbSlot = CBO_BASELINE_MIN_NB_SLOT;
+  that->nbKey = 0;
+  that->keys =
+    PBErrMalloc(
+      that->err,
+      sizeof(uint64_t) * that->nbSlot);
+  memset(
+    that->keys,
+    0,
+    sizeof(uint64_t) * that->nbSlot);
+
+  // Return the new baseline
+  return that;
+
+}
+
+// Function to free the memory used by the CBoBaseline 'that'
+void CBoBaselineFree(CBoBaseline** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Free memory
+  free((*that)->keys);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Add the 'key' to the CBoBaseline 'that', growing it to keep it at
+// most half full
+void CBoBaselineAdd(
+  CBoBaseline* const that,
+      const uint64_t key) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (key == 0) {
+
+    CBoErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      CBoErr->_msg,
+      "'key' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the baseline would be more than half full, double its number of
+  // slots and move the keys in the new slots
+  if ((that->nbKey + 1) * 2 > that->nbSlot) {
+
+    uint64_t* keys = that->keys;
+    size_t nbSlot = that->nbSlot;
+    that->nbSlot *= 2;
+    that->nbKey = 0;
+    that->keys =
+      PBErrMalloc(
+        that->err,
+        sizeof(uint64_t) * that->nbSlot);
+    memset(
+      that->keys,
+      0,
+      sizeof(uint64_t) * that->nbSlot);
+    for (
+      size_t iSlot = 0;
+      iSlot < nbSlot;
+      ++iSlot) {
+
+      if (keys[iSlot] != 0) {
+
+        CBoBaselineAdd(
+          that,
+          keys[iSlot]);
+
+      }
+
+    }
+
+    free(keys);
+
+  }
+
+  // Probe the slots from the one of the key until the key or an empty
+  // slot is found, and add the key if it's not already there
+  size_t mask = that->nbSlot - 1;
+  size_t iSlot = (size_t)(key ^ (key >> 32)) & mask;
+  while (
+    that->keys[iSlot] != 0 &&
+    that->keys[iSlot] != key) {
+
+    iSlot = (iSlot + 1) & mask;
+
+  }
+
+  if (that->keys[iSlot] == 0) {
+
+    that->keys[iSlot] = key;
+    ++(that->nbKey);
+
+  }
+
+}
+
+// Check if the 'key' is in the CBoBaseline 'that'
+// Return true if the key is in the baseline, else false
+bool CBoBaselineContains(
+  const CBoBaseline* const that,
+            const uint64_t key) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Probe the slots from the one of the key until the key or an empty
+  // slot is found, the baseline is never full
+  size_t mask = that->nbSlot - 1;
+  size_t iSlot = (size_t)(key ^ (key >> 32)) & mask;
+  while (
+    that->keys[iSlot] != 0 &&
+    that->keys[iSlot] != key) {
+
+    iSlot = (iSlot + 1) & mask;
+
+  }
+
+  return (that->keys[iSlot] == key);
+
+}
+
+// Load the baseline of the CBo 'that' from its baseline file
+// Return true if the baseline could be loaded, else false
+bool CBoBaselineLoad(CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Open the baseline file
+  FILE* fp =
+    fopen(
+      that->baselinePath,
+      "r");
+  if (fp == NULL) {
+
+    fprintf(
+      that->stream,
+      "Failed to read the baseline [%s]\n",
+      that->baselinePath);
+    return false;
+
+  }
+
+  // Create the baseline
+  CBoBaselineFree(&(that->baseline));
+  that->baseline = CBoBaselineCreate(that);
+
+  // Read the header
+  unsigned int version = 0;
+  bool success =
+    (fscanf(
+      fp,
+      "CBoBaseline %u",
+      &version) == 1 &&
+    fgetc(fp) == '\n' &&
+    version == CBO_BASELINE_VERSION);
+
+  // Loop on the entries, one per line: the line hash, the occurrence,
+  // the rule and the path, which may contain spaces
+  char* line = NULL;
+  size_t size = 0;
+  while (
+    success == true &&
+    getline(
+      &line,
+      &size,
+      fp) > 0) {
+
+    // Parse the entry in place in the buffer of the line, much faster
+    // than sscanf on large baselines
+    char* end = NULL;
+    unsigned long lineHash =
+      strtoul(
+        line,
+        &end,
+        16);
+    success = (end != line && *end == ' ');
+    char* ptr = end;
+    unsigned long occurrence =
+      strtoul(
+        ptr,
+        &end,
+        10);
+    success &= (end != ptr && *end == ' ');
+    char* ruleId = end + 1;
+    char* path = NULL;
+    if (success == true) {
+
+      path =
+        strchr(
+          ruleId,
+          ' ');
+      success = (path != NULL);
+
+    }
+
+    // If the entry is valid, add it, without the end of line of the
+    // path
+    if (success == true) {
+
+      *path = '\0';
+      ++path;
+      path[strcspn(path, "\n")] = '\0';
+      CBoBaselineAdd(
+        that->baseline,
+        CBoBaselineGetKey(
+          path,
+          ruleId,
+          (uint32_t)lineHash,
+          (unsigned int)occurrence));
+
+    }
+
+  }
+
+  free(line);
+  fclose(fp);
+
+  // If the baseline is invalid, display a message
+  if (success == false) {
+
+    fprintf(
+      that->stream,
+      "The baseline [%s] is invalid\n",
+      that->baselinePath);
+
+  }
+
+  // Return the success flag
+  return success;
+
+}
+
+// Compare the CBoBaselineEntry 'a' and 'b' by rule, then by line
+// content, then by index, for qsort
+// Return -1, 0 or 1
+int CBoBaselineEntryCmpContent(
+  const void* a,
+  const void* b) {
+
+#if BUILDMODE == 0
+  if (a == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'a' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (b == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'b' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  const CBoBaselineEntry* entryA = (const CBoBaselineEntry*)a;
+  const CBoBaselineEntry* entryB = (const CBoBaselineEntry*)b;
+
+  // Compare the rules, then the line contents, the index is used to
+  // keep the order total
+  if (entryA->error->type != entryB->error->type) {
+
+    return (entryA->error->type < entryB->error->type ? -1 : 1);
+
+  }
+
+  if (entryA->lineHash != entryB->lineHash) {
+
+    return (entryA->lineHash < entryB->lineHash ? -1 : 1);
+
+  }
+
+  return (entryA->iError < entryB->iError ? -1 : 1);
+
+}
+
+// Compare the CBoBaselineEntry 'a' and 'b' by index, for qsort
+// Return -1, 0 or 1
+int CBoBaselineEntryCmpIndex(
+  const void* a,
+  const void* b) {
+
+#if BUILDMODE == 0
+  if (a == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'a' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (b == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'b' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  const CBoBaselineEntry* entryA = (const CBoBaselineEntry*)a;
+  const CBoBaselineEntry* entryB = (const CBoBaselineEntry*)b;
+  return (entryA->iError < entryB->iError ? -1 : 1);
+
+}
+
+// Get the entries in the baseline of the errors of the CBoFile 'that',
+// in the order of the errors
+// Return the array of entries, to be freed by the caller, NULL if the
+// file has no error
+CBoBaselineEntry* CBoFileGetBaselineEntries(const CBoFile* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the file has no error, there is no entry
+  unsigned int nbError = GSetNbElem(&(that->errors));
+  if (nbError == 0) {
+
+    return NULL;
+
+  }
+
+  // Create the entries with the line hash of the errors
+  CBoBaselineEntry* entries =
+    PBErrMalloc(
+      that->err,
+      sizeof(CBoBaselineEntry) * nbError);
+  GSetIterForward iter = GSetIterForwardCreateStatic(&(that->errors));
+  unsigned int iError = 0;
+  do {
+
+    CBoError* error = GSetIterGet(&iter);
+    entries[iError].error = error;
+    entries[iError].iError = iError;
+    entries[iError].lineHash =
+      CBoFileGetLineHash(
+        that,
+        error->iLine);
+    entries[iError].occurrence = 0;
+    ++iError;
+
+  } while (GSetIterStep(&iter) == true);
+
+  // Sort the entries by rule and line content, and number the
+  // successive errors with the same rule and line content, then put
+  // the entries back in the order of the errors
+  qsort(
+    entries,
+    nbError,
+    sizeof(CBoBaselineEntry),
+    CBoBaselineEntryCmpContent);
+  for (
+    iError = 1;
+    iError < nbError;
+    ++iError) {
+
+    if (
+      entries[iError].error->type == entries[iError - 1].error->type &&
+      entries[iError].lineHash == entries[iError - 1].lineHash) {
+
+      entries[iError].occurrence = entries[iError - 1].occurrence + 1;
+
+    }
+
+  }
+
+  qsort(
+    entries,
+    nbError,
+    sizeof(CBoBaselineEntry),
+    CBoBaselineEntryCmpIndex);
+
+  // Return the entries
+  return entries;
+
+}
+
+// Remove from the errors of the CBoFile 'that' the ones in the baseline
+// of the CBo 'cbo', and keep at most 'nbMaxError' of the others (0 if
+// there is no limit)
+// Return true if the file has no other error, else false
+bool CBoFileApplyBaseline(
+      CBoFile* const that,
+    const CBo* const cbo,
+  const unsigned int nbMaxError) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the entries of the errors, and empty the set of errors
+  unsigned int nbError = GSetNbElem(&(that->errors));
+  CBoBaselineEntry* entries = CBoFileGetBaselineEntries(that);
+  GSetFlush(&(that->errors));
+
+  // Loop on the errors
+  for (
+    unsigned int iError = 0;
+    iError < nbError;
+    ++iError) {
+
+    // Put the error back, in the order of the lines, unless it's known
+    // or the maximum number of errors is reached
+    CBoError* error = entries[iError].error;
+    uint64_t key =
+      CBoBaselineGetKey(
+        that->filePath,
+        cboErrorTypeId[error->type],
+        entries[iError].lineHash,
+        entries[iError].occurrence);
+    if (
+      CBoBaselineContains(
+        cbo->baseline,
+        key) == true ||
+      (nbMaxError > 0 &&
+      GSetNbElem(&(that->errors)) >= nbMaxError)) {
+
+      CBoErrorFree(&error);
+
+    } else {
+
+      GSetAddSort(
+        &(that->errors),
+        error,
+        error->iLine);
+
+    }
+
+  }
+
+  free(entries);
+
+  // Return true if there is no other error
+  return (GSetNbElem(&(that->errors)) == 0);
+
+}
+
+// Save on the stream 'stream' the entries in the baseline of the
+// errors of the CBoFile 'that'
+void CBoFileSaveBaseline(
+  const CBoFile* const that,
+           FILE* const stream) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (stream == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'stream' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Loop on the entries of the errors
+  CBoBaselineEntry* entries = CBoFileGetBaselineEntries(that);
+  for (
+    unsigned int iError = 0;
+    iError < GSetNbElem(&(that->errors));
+    ++iError) {
+
+    // Save the entry, the path last as it may contain spaces
+    fprintf(
+      stream,
+      "%08x %u %s %s\n",
+      entries[iError].lineHash,
+      entries[iError].occurrence,
+      cboErrorTypeId[entries[iError].error->type],
+      that->filePath);
+
+  }
+
+  free(entries);
+
+}
+
+// Function to create a new CBoFile from its file path, for the CBo
+// 'cbo' whose threads and error state it uses
+// Return a pointer to the new CBoFile
+CBoFile* CBoFileCreate(
+  const char* const filePath,
+   const CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (filePath == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'filePath' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Create the new CBoFile
+  CBoFile* that = (CBoFile*)malloc(sizeof(CBoFile));
+
+  // Initialise properties
+  that->filePath = filePath;
+  that->type = CBoFileGetTypeFromPath(filePath);
+  that->lines = GSetCreateStatic();
+  that->errors = GSetCreateStatic();
+  that->lineArr = NULL;
+  that->nbWord = 0;
+  that->lineFlags[0] = NULL;
+  that->suppressed = NULL;
+  that->strOrig = NULL;
+  that->nbLineOrig = 0;
+  that->indentCheckpoints = NULL;
+  that->nbIndentCheckpoint = 0;
+  that->nbMaxError = 0;
+  that->failedRules = 0;
+  that->output = NULL;
+  that->outputSize = 0;
+  that->isChecked = false;
+  that->isCorrect = true;
+  that->isAborted = false;
+  that->checkTime = 0.0;
+  that->err = cbo->err;
+
+  // Declare a variable to manage error while reading the lines
+  int ret = !EOF;
+
+  // If it's a known type
+  if (that->type != CBoFileType_unknown) {
+
+    // Open the file
+    FILE* fp =
+      fopen(
+        filePath,
+        "r");
+
+    // Declare a buffer to read one line
+    char buffer[1000];
+
+    // Loop on the lines of the file
+    while (!feof(fp) && ret != EOF) {
+
+      // Create a pointer on the char of the line
+      char* ptr = buffer;
+      *ptr = '\0';
+
+      // Loop on the char of the line until the end of the line or
+      // an error occured or we reach the end of the file or the end
+      // of the buffer
+      while (
+        *ptr != '\n' &&
+        !feof(fp) &&
+        ret != EOF &&
+        ptr < buffer + 999) {
+
+        // Read one char
+        ret =
+          fscanf(
+            fp,
+            "%c",
+            ptr);
+
+        // If we could read the character and it wasn't the end
+        // of the line
+        if (ret != EOF && *ptr != '\n') {
+
+          // Move to the next char, and clear it to not test garbage
+          // on the next iteration
+          ++ptr;
+          *ptr = '\0';
+
+        }
+
+      }
+
+      // If there was an error
+      if ((!feof(fp) && ret == EOF) || ptr >= buffer + 999) {
+
+        ret = EOF;
+
+      // Else there was no error while reading the line
+      } else {
+
+        // Add the null character to the end of the string
+        *ptr = '\0';
+
+        // Create the CBoLine
+        CBoLine* line = CBoLineCreate(buffer);
+
+        // If we couldn't create the CBoLine
+        if (line != NULL) {
+
+          GSetAppend(
+            &(that->lines),
+            line);
+
+        } else {
+
+          ret = EOF;
+
+        }
+
+      }
+
+    }
+
+    // If there has been an error
+    if (!feof(fp) && ret == EOF) {
+
+      CBoFileFree(&that);
+
+    }
+
+    // Close the file
+    fclose(fp);
+
+  }
+
+  // If the file could be loaded
+  if (that != NULL) {
+
+    // Calculate the properties of the lines of the file
+    CBoFileUpdateLineFlags(that);
+
+    // Calculate the proper indentation level of each line of the file
+    CBoFileUpdateIndentLvlLines(
+      that,
+      cbo->nbThread);
+
+  }
+
+  // Return the new CBoFile
+  return that;
+
+}
+
+// Function to detect the type of a file from its path
+// Return a CBoFileType
+CBoFileType CBoFileGetTypeFromPath(const char* const filePath) {
+
+#if BUILDMODE == 0
+  if (filePath == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'filePath' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the position of the last '.'
+  char* ptr =
+    strrchr(
+      filePath,
+      '.');
+
+  // If we could find the last '.'
+  if (ptr != NULL) {
+
+    unsigned int retStrCmp =
+      strcmp(
+        ptr,
+        ".c");
+    if (retStrCmp == 0) {
+
+      return CBoFileType_C_body;
+
+    } else {
+
+      retStrCmp =
+        strcmp(
+          ptr,
+          ".h");
+      if (retStrCmp == 0) {
+
+        return CBoFileType_C_header;
+
+      }
+
+    }
+
+  }
+
+  // By default return 'unknown'
+  return CBoFileType_unknown;
+
+}
+
+// Return the number of errors in the CBoFile 'that'
+unsigned int CBoFileGetNbError(const CBoFile* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Return the number of error
+  return GSetNbElem(&(that->errors));
+
+}
+
+// Return true if the CBoFile 'that' has reached its maximum number of
+// errors, else false
+bool CBoFileIsErrorBudgetSpent(const CBoFile* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Return the flag
+  return (
+    that->nbMaxError > 0 &&
+    GSetNbElem(&(that->errors)) >= that->nbMaxError);
+
+}
+
+// Function to free the memory used by the CBoFile 'that'
+void CBoFileFree(CBoFile** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Free the lines
+  while (GSetNbElem(&((*that)->lines)) > 0) {
+
+    CBoLine* line = GSetPop(&((*that)->lines));
+    CBoLineFree(&line);
+
+  }
+
+  // Free the errors
+  while (GSetNbElem(&((*that)->errors)) > 0) {
+
+    CBoError* error = GSetPop(&((*that)->errors));
+    CBoErrorFree(&error);
+
+  }
+
+  // Free the array of lines, the bitsets and the checkpoints
+  free((*that)->lineArr);
+  free((*that)->lineFlags[0]);
+  free((*that)->suppressed);
+  free((*that)->indentCheckpoints);
+
+  // Free the CBoFile
+  free(*that);
+  *that = NULL;
+
+}
+
+// Function to free the memory used by the lines of the CBoFile 'that',
+// once its errors have been displayed
+void CBoFileFreeLines(CBoFile* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Free the lines
+  while (GSetNbElem(&(that->lines)) > 0) {
+
+    CBoLine* line = GSetPop(&(that->lines));
+    CBoLineFree(&line);
+
+  }
+
+  // Free the array of lines and the bitsets
+  free(that->lineArr);
+  that->lineArr = NULL;
+  free(that->lineFlags[0]);
+  for (
+    unsigned int iFlag = 0;
+    iFlag < CBoLineFlag_nb;
+    ++iFlag) {
+
+    that->lineFlags[iFlag] = NULL;
+
+  }
+
+  free(that->suppressed);
+  that->suppressed = NULL;
+  that->nbWord = 0;
+  free(that->indentCheckpoints);
+  that->indentCheckpoints = NULL;
+  that->nbIndentCheckpoint = 0;
+
+  // The errors are kept to be counted, detach them from their line
+  if (GSetNbElem(&(that->errors)) > 0) {
+
+    GSetIterForward iter = GSetIterForwardCreateStatic(&(that->errors));
+    do {
+
+      CBoError* error = GSetIterGet(&iter);
+      error->line = NULL;
+
+    } while (GSetIterStep(&iter) == true);
+
+  }
+
+}
+
+// Calculate the proper indentation level of each line of the
+// CBoFile 'that', using up to 'nbThread' threads
+void CBoFileUpdateIndentLvlLines(
+      CBoFile* const that,
+  const unsigned int nbThread) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the number of lines
+  unsigned int nbLine = GSetNbElem(&(that->lines));
+
+  // Free the checkpoints of a previous calculation
+  free(that->indentCheckpoints);
+  that->indentCheckpoints = NULL;
+  that->nbIndentCheckpoint = 0;
+
+  // If the file is empty, nothing to do
+  if (nbLine == 0) {
+
+    return;
+
+  }
+
+  // Allocate memory for the checkpoints, saved by the chunks as they
+  // calculate the indentation levels of their lines
+  that->nbIndentCheckpoint =
+    (nbLine + CBOFILE_INDENT_NB_LINE_CHECKPOINT - 1) /
+    CBOFILE_INDENT_NB_LINE_CHECKPOINT;
+  that->indentCheckpoints =
+    PBErrMalloc(
+      that->err,
+      sizeof(CBoIndentState) * that->nbIndentCheckpoint);
+
+  // Allocate memory for the properties of the lines
+  unsigned short* props =
+    PBErrMalloc(
+      that->err,
+      sizeof(unsigned short) * nbLine);
+
+  // Get the number of chunks, one per thread as long as the chunks are
+  // big enough to be worth it
+  unsigned int nbChunk = nbLine / CBOFILE_INDENT_CHUNK_MIN_NB_LINE;
+  if (nbChunk > nbThread) {
+
+    nbChunk = nbThread;
+
+  }
+
+  if (nbChunk == 0) {
+
+    nbChunk = 1;
+
+  }
+
+  // Create the chunks
+  CBoIndentChunk* chunks =
+    PBErrMalloc(
+      that->err,
+      sizeof(CBoIndentChunk) * nbChunk);
+  for (
+    unsigned int iChunk = 0;
+    iChunk < nbChunk;
+    ++iChunk) {
+
+    chunks[iChunk].file = that;
+    chunks[iChunk].props = props;
+    chunks[iChunk].iFirstLine =
+      (unsigned int)((uint64_t)nbLine * iChunk / nbChunk);
+    chunks[iChunk].nbLine =
+      (unsigned int)((uint64_t)nbLine * (iChunk + 1) / nbChunk) -
+      chunks[iChunk].iFirstLine;
+
+  }
+
+  // The initial state of the file
+  chunks[0].stateIn.indent = 0;
+  chunks[0].stateIn.flags = 0;
+
+  // If there is only one chunk
+  if (nbChunk == 1) {
+
+    // Calculate the properties of the lines and the indentation levels
+    // in one pass, the summary of the chunk is not needed
+    for (
+      unsigned int iLine = 0;
+      iLine < nbLine;
+      ++iLine) {
+
+      props[iLine] =
+        CBoFileGetIndentLineProp(
+          that,
+          iLine);
+
+    }
+
+    CBoIndentChunkApply(chunks);
+
+  // Else, the file is split in several chunks
+  } else {
+
+    // The state of the calculation is made of the indentation level and
+    // a few flags. The flags don't depend on the indentation level, and
+    // the indentation level only varies by increments depending on the
+    // flags. So, each chunk can be summarised independently by its
+    // outgoing flags and variation of indentation level for each
+    // combination of incoming flags
+    // The first chunk is processed by the current thread, and the
+    // chunks whose thread couldn't be started too
+    pthread_t* threads =
+      PBErrMalloc(
+        that->err,
+        sizeof(pthread_t) * nbChunk);
+    bool* isStarted =
+      PBErrMalloc(
+        that->err,
+        sizeof(bool) * nbChunk);
+    isStarted[0] = false;
+    for (
+      unsigned int iChunk = 1;
+      iChunk < nbChunk;
+      ++iChunk) {
+
+      int ret =
+        pthread_create(
+          threads + iChunk,
+          NULL,
+          CBoIndentChunkSummarize,
+          chunks + iChunk);
+      isStarted[iChunk] = (ret == 0);
+
+    }
+
+    for (
+      unsigned int iChunk = 0;
+      iChunk < nbChunk;
+      ++iChunk) {
+
+      if (isStarted[iChunk] == true) {
+
+        pthread_join(
+          threads[iChunk],
+          NULL);
+
+      } else {
+
+        CBoIndentChunkSummarize(chunks + iChunk);
+
+      }
+
+    }
+
+    // Combine the summaries in order to get the incoming state of each
+    // chunk. There is one chunk per thread, so the scan is done
+    // sequentially
+    for (
+      unsigned int iChunk = 1;
+      iChunk < nbChunk;
+      ++iChunk) {
+
+      CBoIndentChunk* prev = chunks + iChunk - 1;
+      chunks[iChunk].stateIn.indent =
+        prev->stateIn.indent + prev->deltaIndent[prev->stateIn.flags];
+      chunks[iChunk].stateIn.flags = prev->flagsOut[prev->stateIn.flags];
+
+    }
+
+    // Calculate the indentation levels of each chunk from its incoming
+    // state
+    for (
+      unsigned int iChunk = 1;
+      iChunk < nbChunk;
+      ++iChunk) {
+
+      int ret =
+        pthread_create(
+          threads + iChunk,
+          NULL,
+          CBoIndentChunkApply,
+          chunks + iChunk);
+      isStarted[iChunk] = (ret == 0);
+
+    }
+
+    for (
+      unsigned int iChunk = 0;
+      iChunk < nbChunk;
+      ++iChunk) {
+
+      if (isStarted[iChunk] == true) {
+
+        pthread_join(
+          threads[iChunk],
+          NULL);
+
+      } else {
+
+        CBoIndentChunkApply(chunks + iChunk);
+
+      }
+
+    }
+
+    free(threads);
+    free(isStarted);
+
+  }
+
+  // Free memory
+  free(chunks);
+  free(props);
+
+}
+
+// Get the properties of the line 'iLine' of the CBoFile 'that' used
+// to calculate the indentation levels
+// Return a combination of CBoIndentLineProp
+unsigned short CBoFileGetIndentLineProp(
+  const CBoFile* const that,
+    const unsigned int iLine) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the properties
+  unsigned short prop = 0;
+
+  // Get the line
+  const CBoLine* line = that->lineArr[iLine];
+
+  // Get the length of the line
+  unsigned int length = CBoLineGetLength(line);
+
+  // Get the position of the head of the line
+  unsigned int posHead = CBoLineGetPosHead(line);
+
+  // Check if we are on a for(...)
+  char* ptrFor =
+    strstr(
+      line->str,
+      "for (");
+  if (ptrFor == line->str + posHead) {
+
+    prop |= CBoIndentLineProp_for;
+
+  }
+
+  // Check if we are on a case ...: or default:
+  char* ptrCase =
+    strstr(
+      line->str,
+      "case ");
+  char* ptrDefault =
+    strstr(
+      line->str,
+      "default:");
+  if (
+    ptrCase == line->str + posHead ||
+    ptrDefault == line->str + posHead) {
+
+    prop |= CBoIndentLineProp_case;
+
+  }
+
+  // Check if the line starts with '}' and is not a precompiler command
+  bool isPrecompilCmd =
+    CBoFileIsLinePrecompilCmd(
+      that,
+      iLine);
+  if (
+    line->str[posHead] == '}' &&
+    isPrecompilCmd == false) {
+
+    prop |= CBoIndentLineProp_closeCurly;
+
+  }
+
+  // If the line is not empty and not a comment and not a precompiler
+  // command
+  if (
+    length > 0 &&
+    CBoLineIsComment(line) == false &&
+    isPrecompilCmd == false) {
+
+    // Check the last char of the line
+    char tail = line->str[length - 1];
+    if (tail == '{') {
+
+      prop |= CBoIndentLineProp_openCurly;
+
+    } else if (tail == '(') {
+
+      prop |= CBoIndentLineProp_openParenthesis;
+
+    } else if (tail == '=') {
+
+      prop |= CBoIndentLineProp_equal;
+
+    } else if (tail == ';') {
+
+      prop |= CBoIndentLineProp_semicolon;
+
+    } else if (tail == ':') {
+
+      prop |= CBoIndentLineProp_colon;
+
+    }
+
+  }
+
+  // Check if the line is the break line of a case
+  char* ptrBreak =
+    strstr(
+      line->str,
+      "break;");
+  if (ptrBreak == line->str + posHead) {
+
+    prop |= CBoIndentLineProp_break;
+
+  }
+
+  // Return the properties
+  return prop;
+
+}
+
+// Update the CBoIndentState 'that' with a line of properties 'prop'
+// Return the indentation level of the line
+unsigned int CBoIndentStateStep(
+  CBoIndentState* const that,
+   const unsigned short prop) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If we are on a for(...)
+  if ((prop & CBoIndentLineProp_for) != 0) {
+
+    that->flags |= CBoIndentFlag_for;
+
+  }
+
+  // If we are on a case ...: or default:
+  if ((prop & CBoIndentLineProp_case) != 0) {
+
+    that->flags |= CBoIndentFlag_case;
+
+  }
+
+  // If the line starts with '}' and is not a precompiler command
+  if ((prop & CBoIndentLineProp_closeCurly) != 0) {
+
+    // Decrement the indent level
+    that->indent -= CBOLINE_INDENT_SIZE;
+
+  }
+
+  // Memorize the indent level of the line
+  unsigned int indentLine = that->indent;
+
+  // If the line ends with '{'
+  if ((prop & CBoIndentLineProp_openCurly) != 0) {
+
+    // If we are not on a line inside parenthesis
+    if ((that->flags & CBoIndentFlag_inParenthesis) == 0) {
+
+      // Increment the indent level
+      that->indent += CBOLINE_INDENT_SIZE;
+
+    }
+
+    // Update the flag
+    that->flags &= ~(CBoIndentFlag_inParenthesis | CBoIndentFlag_for);
+
+  // If the line ends with '('
+  } else if ((prop & CBoIndentLineProp_openParenthesis) != 0) {
+
+    // Increment the indent level
+    that->indent += CBOLINE_INDENT_SIZE;
+
+    // Update the flag
+    that->flags |= CBoIndentFlag_inParenthesis;
+
+  // If the line ends with '='
+  } else if ((prop & CBoIndentLineProp_equal) != 0) {
+
+    // Update the multiline flag
+    that->flags |= CBoIndentFlag_multiline;
+
+    // Increment the indent level
+    that->indent += CBOLINE_INDENT_SIZE;
+
+  // Else if the line ends with ';'
+  } else if ((prop & CBoIndentLineProp_semicolon) != 0) {
+
+    // If we are on a multiline
+    if ((that->flags & CBoIndentFlag_multiline) != 0) {
+
+      // Update the multiline flag
+      that->flags &= ~CBoIndentFlag_multiline;
+
+      // Decrement the indent level
+      that->indent -= CBOLINE_INDENT_SIZE;
+
+    }
+
+    // If we are inside parenthesis but not in a for (...)
+    if (
+      (that->flags & CBoIndentFlag_inParenthesis) != 0 &&
+      (that->flags & CBoIndentFlag_for) == 0) {
+
+      // Update the flag
+      that->flags &= ~CBoIndentFlag_inParenthesis;
+
+      // Decrement the indent level
+      that->indent -= CBOLINE_INDENT_SIZE;
+
+    }
+
+    // If we are in a case ... and the line is the break line of the
+    // case
+    if (
+      (that->flags & CBoIndentFlag_case) != 0 &&
+      (prop & CBoIndentLineProp_break) != 0) {
+
+      // Update the flag
+      that->flags &= ~CBoIndentFlag_case;
+
+      // Decrement the indent level
+      that->indent -= CBOLINE_INDENT_SIZE;
+
+    }
+
+  // Else if the line ends with ':'
+  } else if ((prop & CBoIndentLineProp_colon) != 0) {
+
+    // Update the flag
+    that->flags |= CBoIndentFlag_case;
+
+    // Increment the indent level
+    that->indent += CBOLINE_INDENT_SIZE;
+
+  }
+
+  // Return the indent level of the line
+  return indentLine;
+
+}
+
+// Calculate the properties of the lines of the CBoIndentChunk 'arg'
+// and its summary for each combination of incoming flags
+// Return NULL
+void* CBoIndentChunkSummarize(void* arg) {
+
+#if BUILDMODE == 0
+  if (arg == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'arg' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the chunk
+  CBoIndentChunk* that = (CBoIndentChunk*)arg;
+
+  // Declare the states of the calculation, one per combination of
+  // incoming flags, starting with a null indent level, so the final
+  // indent levels are the variations over the chunk
+  CBoIndentState states[CBoIndentFlag_nb];
+
+  // Declare an array to memorize for each combination of incoming
+  // flags the index of the state it follows. Once two states have the
+  // same flags, they evolve identically except for a constant
+  // difference of indent level, so only one of them needs to be
+  // updated. In practice all the states converge quickly
+  unsigned int iState[CBoIndentFlag_nb];
+  unsigned int deltaState[CBoIndentFlag_nb];
+
+  // Declare a variable to memorize the number of combinations which
+  // still follow their own state
+  unsigned int nbState = CBoIndentFlag_nb;
+  for (
+    unsigned int flags = 0;
+    flags < CBoIndentFlag_nb;
+    ++flags) {
+
+    states[flags].indent = 0;
+    states[flags].flags = flags;
+    iState[flags] = flags;
+    deltaState[flags] = 0;
+
+  }
+
+  // Loop on the lines of the chunk
+  for (
+    unsigned int iLine = that->iFirstLine;
+    iLine < that->iFirstLine + that->nbLine;
+    ++iLine) {
+
+    // Calculate the properties of the line
+    unsigned short prop =
+      CBoFileGetIndentLineProp(
+        that->file,
+        iLine);
+    that->props[iLine] = prop;
+
+    // Update the states still followed
+    for (
+      unsigned int flags = 0;
+      flags < CBoIndentFlag_nb;
+      ++flags) {
+
+      if (iState[flags] == flags) {
+
+        CBoIndentStateStep(
+          states + flags,
+          prop);
+
+      }
+
+    }
+
+    // If several states are still followed, merge the ones with the
+    // same flags
+    if (nbState > 1) {
+
+      for (
+        unsigned int flags = 0;
+        flags < CBoIndentFlag_nb;
+        ++flags) {
+
+        for (
+          unsigned int prevFlags = 0;
+          prevFlags < flags &&
+          iState[flags] == flags;
+          ++prevFlags) {
+
+          if (
+            iState[prevFlags] == prevFlags &&
+            states[prevFlags].flags == states[flags].flags) {
+
+            // Make all the combinations following 'flags' follow
+            // 'prevFlags' instead
+            unsigned int delta =
+              states[flags].indent - states[prevFlags].indent;
+            for (
+              unsigned int other = 0;
+              other < CBoIndentFlag_nb;
+              ++other) {
+
+              if (iState[other] == flags) {
+
+                iState[other] = prevFlags;
+                deltaState[other] += delta;
+
+              }
+
+            }
+
+            --nbState;
+
+          }
+
+        }
+
+      }
+
+    }
+
+  }
+
+  // Memorize the summary of the chunk
+  for (
+    unsigned int flags = 0;
+    flags < CBoIndentFlag_nb;
+    ++flags) {
+
+    const CBoIndentState* state = states + iState[flags];
+    that->flagsOut[flags] = state->flags;
+    that->deltaIndent[flags] = state->indent + deltaState[flags];
+
+  }
+
+  // Return NULL
+  return NULL;
+
+}
+
+// Calculate the indentation levels of the lines of the CBoIndentChunk
+// 'arg' from its incoming state
+// Return NULL
+void* CBoIndentChunkApply(void* arg) {
+
+#if BUILDMODE == 0
+  if (arg == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'arg' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the chunk
+  CBoIndentChunk* that = (CBoIndentChunk*)arg;
+
+  // Start from the incoming state of the chunk
+  CBoIndentState state = that->stateIn;
+
+  // Loop on the lines of the chunk
+  for (
+    unsigned int iLine = that->iFirstLine;
+    iLine < that->iFirstLine + that->nbLine;
+    ++iLine) {
+
+    // Save the state at the start of the line if it's a checkpoint
+    if (iLine % CBOFILE_INDENT_NB_LINE_CHECKPOINT == 0) {
+
+      unsigned int iCheckpoint = iLine / CBOFILE_INDENT_NB_LINE_CHECKPOINT;
+      that->file->indentCheckpoints[iCheckpoint] = state;
+
+    }
+
+    // Update the state and the indent level of the line
+    that->file->lineArr[iLine]->indent =
+      CBoIndentStateStep(
+        &state,
+        that->props[iLine]);
+
+  }
+
+  // Return NULL
+  return NULL;
+
+}
+
+// Create the array of lines and calculate the bitsets of properties of
+// the lines of the CBoFile 'that'
+void CBoFileUpdateLineFlags(CBoFile* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the number of lines
+  unsigned int nbLine = GSetNbElem(&(that->lines));
+
+  // Allocate memory for the array of lines
+  that->lineArr =
+    PBErrMalloc(
+      that->err,
+      sizeof(CBoLine*) * (nbLine + 1));
+
+  // Allocate memory for the bitsets, all in one block, and reset them
+  that->nbWord =
+    (nbLine + CBOFILE_NB_LINE_PER_WORD - 1) / CBOFILE_NB_LINE_PER_WORD;
+  size_t sizeFlags = sizeof(uint64_t) * (that->nbWord * CBoLineFlag_nb + 1);
+  that->lineFlags[0] =
+    PBErrMalloc(
+      that->err,
+      sizeFlags);
+  memset(
+    that->lineFlags[0],
+    0,
+    sizeFlags);
+  for (
+    unsigned int iFlag = 1;
+    iFlag < CBoLineFlag_nb;
+    ++iFlag) {
+
+    that->lineFlags[iFlag] = that->lineFlags[0] + iFlag * that->nbWord;
+
+  }
+
+  // If the file is not empty
+  if (nbLine > 0) {
+
+    // Declare a variable to memorize if the previous line is a
+    // precompiler command ending with a continuation mark
+    bool isPrevContinuedCmd = false;
+
+    // Declare variables to memorize the mask (1 << CBoErrorType) of the
+    // error types suppressed until the next 'cbo-on' comment, and the
+    // one of the error types suppressed on the next line
+    unsigned int typesOff = 0;
+    unsigned int typesNextLine = 0;
+
+    // Declare an iterator on the lines
+    GSetIterForward iter =
+      GSetIterForwardCreateStatic(&(that->lines));
+
+    // Loop on the lines
+    unsigned int iLine = 0;
+    do {
+
+      // Get the line
+      CBoLine* line = GSetIterGet(&iter);
+      that->lineArr[iLine] = line;
+
+      // Get the position of the head and the length of the line
+      unsigned int posHead = CBoLineGetPosHead(line);
+      unsigned int length = CBoLineGetLength(line);
+
+      // Get the first and last characters of the line
+      char head = line->str[posHead];
+      char tail = '\0';
+      if (length > 0) {
+
+        tail = line->str[length - 1];
+
+      }
+
+      // Check if the line starts with a case label
+      bool isCaseLabel = (
+        strncmp(
+          line->str + posHead,
+          "case ",
+          5) == 0 ||
+        strncmp(
+          line->str + posHead,
+          "default:",
+          8) == 0);
+
+      // Check if the line is a precompiler command, either it starts
+      // with '#' or it continues a precompiler command
+      bool isPrecompilCmd = (head == '#' || isPrevContinuedCmd == true);
+      isPrevContinuedCmd = (isPrecompilCmd == true && tail == '\\');
+
+      // Get the index of the word and the mask of the line in the word
+      unsigned int iWord = iLine / CBOFILE_NB_LINE_PER_WORD;
+      uint64_t mask = (uint64_t)1 << (iLine % CBOFILE_NB_LINE_PER_WORD);
+
+      // Set the bits of the line
+      if (length == 0) {
+
+        that->lineFlags[CBoLineFlag_blank][iWord] |= mask;
+
+      }
+
+      if (head == '/') {
+
+        that->lineFlags[CBoLineFlag_comment][iWord] |= mask;
+
+      }
+
+      if (tail == '{') {
+
+        that->lineFlags[CBoLineFlag_openCurlyAtTail][iWord] |= mask;
+
+      }
+
+      if (tail == '}') {
+
+        that->lineFlags[CBoLineFlag_closeCurlyAtTail][iWord] |= mask;
+
+      }
+
+      if (head == '}') {
+
+        that->lineFlags[CBoLineFlag_closeCurlyAtHead][iWord] |= mask;
+
+      }
+
+      if (isCaseLabel == true) {
+
+        that->lineFlags[CBoLineFlag_caseLabel][iWord] |= mask;
+
+      }
+
+      if (tail == '\\') {
+
+        that->lineFlags[CBoLineFlag_continuation][iWord] |= mask;
+
+      }
+
+      if (isPrecompilCmd == true) {
+
+        that->lineFlags[CBoLineFlag_precompilCmd][iWord] |= mask;
+
+      }
+
+      // If the line is a comment, get the kind of suppression comment
+      // it may be
+      unsigned int types = 0;
+      CBoSuppressKind suppressKind = CBoSuppressKind_none;
+      if (head == '/') {
+
+        suppressKind =
+          CBoLineGetSuppressKind(
+            line,
+            &types);
+
+      }
+
+      // Get the error types suppressed on the line, the 'cbo-off' and
+      // 'cbo-on' comments being included in the region they delimit,
+      // and update the suppressed error types
+      unsigned int typesLine = typesOff | typesNextLine;
+      typesNextLine = 0;
+      if (suppressKind == CBoSuppressKind_off) {
+
+        typesOff |= types;
+        typesLine |= types;
+
+      } else if (suppressKind == CBoSuppressKind_on) {
+
+        typesOff &= ~types;
+
+      } else if (suppressKind == CBoSuppressKind_offNextLine) {
+
+        typesNextLine = types;
+
+      }
+
+      // Set the bits of the line in the bitsets of the suppressed error
+      // types
+      if (typesLine != 0) {
+
+        CBoFileSuppressLine(
+          that,
+          iLine,
+          typesLine);
+
+      }
+
+      // Move to the next line
+      ++iLine;
+
+    } while (GSetIterStep(&iter));
+
+  }
+
+}
+
+// Get the kind of the suppression comment on the line 'that', and in
+// 'types' the mask (1 << CBoErrorType) of the error types it names,
+// all of them if it names none
+// Return the kind of the comment
+CBoSuppressKind CBoLineGetSuppressKind(
+  const CBoLine* const that,
+   unsigned int* const types) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (types == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'types' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the kind of the comment
+  CBoSuppressKind kind = CBoSuppressKind_none;
+  *types = 0;
+
+  // Get the head of the line
+  const char* str = that->str + CBoLineGetPosHead(that);
+
+  // If the line starts with a comment
+  if (
+    str[0] == '/' &&
+    (str[1] == '/' || str[1] == '*')) {
+
+    // Skip the opening of the comment and the spaces after it
+    str += 2;
+    while (*str == ' ') ++str;
+
+    // Get the kind of the comment, the longest keyword first as the
+    // other ones are its prefix
+    unsigned int length = 0;
+    if (
+      strncmp(
+        str,
+        "cbo-off-next-line",
+        17) == 0) {
+
+      kind = CBoSuppressKind_offNextLine;
+      length = 17;
+
+    } else if (
+      strncmp(
+        str,
+        "cbo-off",
+        7) == 0) {
+
+      kind = CBoSuppressKind_off;
+      length = 7;
+
+    } else if (
+      strncmp(
+        str,
+        "cbo-on",
+        6) == 0) {
+
+      kind = CBoSuppressKind_on;
+      length = 6;
+
+    }
+
+    // Skip the keyword, if it's followed by a letter, a digit or a
+    // dash it's only the prefix of another word
+    str += length;
+    if (
+      (*str >= 'a' && *str <= 'z') ||
+      (*str >= 'A' && *str <= 'Z') ||
+      (*str >= '0' && *str <= '9') ||
+      *str == '-' ||
+      *str == '_') {
+
+      kind = CBoSuppressKind_none;
+
+    }
+
+    // Skip the spaces after the keyword
+    while (*str == ' ') ++str;
+
+    // If it's a suppression comment followed by a list of error types
+    if (
+      kind != CBoSuppressKind_none &&
+      *str == ':') {
+
+      // Loop on the words of the list, the other characters being
+      // separators, and the words which are not the identifier of an
+      // error type being ignored
+      ++str;
+      while (*str != '\0') {
+
+        // Get the length of the word
+        unsigned int lengthWord = 0;
+        while (
+          (str[lengthWord] >= 'a' && str[lengthWord] <= 'z') ||
+          (str[lengthWord] >= 'A' && str[lengthWord] <= 'Z')) {
+
+          ++lengthWord;
+
+        }
+
+        // If it's a word, add its error type to the mask
+        if (lengthWord > 0) {
+
+          for (
+            unsigned int iType = 0;
+            iType < CBoErrorType_nb;
+            ++iType) {
+
+            if (
+              strlen(cboErrorTypeId[iType]) == lengthWord &&
+              strncmp(
+                str,
+                cboErrorTypeId[iType],
+                lengthWord) == 0) {
+
+              *types |= (1u << iType);
+
+            }
+
+          }
+
+          str += lengthWord;
+
+        // Else, skip the separator
+        } else {
+
+          ++str;
+
+        }
+
+      }
+
+    // Else, if it's a suppression comment without list, it concerns
+    // all the error types
+    } else if (kind != CBoSuppressKind_none) {
+
+      *types = (1u << CBoErrorType_nb) - 1;
+
+    }
+
+  }
+
+  // Return the kind of the comment
+  return kind;
+
+}
+
+// Suppress the errors of the types in the mask (1 << CBoErrorType)
+// 'types' on the line 'iLine' of the CBoFile 'that'
+void CBoFileSuppressLine(
+      CBoFile* const that,
+  const unsigned int iLine,
+  const unsigned int types) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Allocate the bitsets, all in one block, at the first suppressed
+  // line of the file
+  if (that->suppressed == NULL) {
+
+    size_t size = sizeof(uint64_t) * (that->nbWord * CBoErrorType_nb + 1);
+    that->suppressed =
+      PBErrMalloc(
+        that->err,
+        size);
+    memset(
+      that->suppressed,
+      0,
+      size);
+
+  }
+
+  // Get the index of the word and the mask of the line in the word
+  unsigned int iWord = iLine / CBOFILE_NB_LINE_PER_WORD;
+  uint64_t mask = (uint64_t)1 << (iLine % CBOFILE_NB_LINE_PER_WORD);
+
+  // Loop on the types in the mask, from the lowest one
+  unsigned int typesLeft = types;
+  while (typesLeft != 0) {
+
+    // Set the bit of the line in the bitset of the type
+    unsigned int type = __builtin_ctz(typesLeft);
+    that->suppressed[type * that->nbWord + iWord] |= mask;
+
+    // Clear the lowest type
+    typesLeft &= typesLeft - 1;
+
+  }
+
+}
+
+// Get the word 'iWord' of the bitset of the lines of the CBoFile 'that'
+// where the errors of type 'type' are suppressed
+// Return the word
+uint64_t CBoFileGetSuppressedWord(
+  const CBoFile* const that,
+    const CBoErrorType type,
+    const unsigned int iWord) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the file has no suppression comment, no line is suppressed
+  if (that->suppressed == NULL) {
+
+    return 0;
+
+  }
+
+  // Return the word
+  return that->suppressed[type * that->nbWord + iWord];
+
+}
+
+// Check if the errors of type 'type' are suppressed on the line 'iLine'
+// of the CBoFile 'that'
+// Return true if they are suppressed, else false
+bool CBoFileIsSuppressed(
+  const CBoFile* const that,
+    const unsigned int iLine,
+    const CBoErrorType type) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the word of the line
+  uint64_t word =
+    CBoFileGetSuppressedWord(
+      that,
+      type,
+      iLine / CBOFILE_NB_LINE_PER_WORD);
+
+  // Return the bit of the line
+  uint64_t mask = (uint64_t)1 << (iLine % CBOFILE_NB_LINE_PER_WORD);
+  return ((word & mask) != 0);
+
+}
+
+// Get the mask (1 << CBoRuleId) of the rules whose errors are
+// suppressed on the line 'iLine' of the CBoFile 'that'
+// Return the mask
+unsigned int CBoFileGetSuppressedRules(
+  const CBoFile* const that,
+    const unsigned int iLine) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the mask
+  unsigned int mask = 0;
+
+  // If the file has suppression comments
+  if (that->suppressed != NULL) {
+
+    // Loop on the rules
+    for (
+      unsigned int iRule = 0;
+      iRule < CBoRuleId_nb;
+      ++iRule) {
+
+      // If the errors of the rule are suppressed on the line
+      bool isSuppressed =
+        CBoFileIsSuppressed(
+          that,
+          iLine,
+          cboRules[iRule].errorType);
+      if (isSuppressed == true) {
+
+        // Add the rule to the mask
+        mask |= (1u << iRule);
+
+      }
+
+    }
+
+  }
+
+  // Return the mask
+  return mask;
+
+}
+
+// Get the word 'iWord' of the bitset 'bitset' shifted by one line, i.e.
+// where the bit of each line is the bit of the previous line in
+// 'bitset' (0 for the first line)
+// Return the shifted word
+uint64_t CBoBitsetGetPrevWord(
+  const uint64_t* const bitset,
+     const unsigned int iWord) {
+
+#if BUILDMODE == 0
+  if (bitset == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'bitset' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Shift the word toward the next lines
+  uint64_t word = bitset[iWord] << 1;
+
+  // Add the last line of the previous word
+  if (iWord > 0) {
+
+    word |= bitset[iWord - 1] >> (CBOFILE_NB_LINE_PER_WORD - 1);
+
+  }
+
+  // Return the shifted word
+  return word;
+
+}
+
+// Add to the CBoFile 'that' one error of type 'type' for each bit set
+// in the word 'word' of index 'iWord' in a bitset of lines
+// Return true if there was no error to add, else false
+bool CBoFileAddErrorsFromWord(
+      CBoFile* const that,
+            uint64_t word,
+  const unsigned int iWord,
+  const CBoErrorType type) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Discard the lines where the errors of this type are suppressed
+  word &=
+    ~CBoFileGetSuppressedWord(
+      that,
+      type,
+      iWord);
+
+  // Get the index of the first line of the word
+  unsigned int iLineFirst = iWord * CBOFILE_NB_LINE_PER_WORD;
+
+  // If it's the last word, discard the bits after the last line
+  unsigned int nbLine = GSetNbElem(&(that->lines));
+  if (nbLine - iLineFirst < CBOFILE_NB_LINE_PER_WORD) {
+
+    word &= ((uint64_t)1 << (nbLine - iLineFirst)) - 1;
+
+  }
+
+  // Memorize if there was no error
+  bool noError = (word == 0);
+
+  // Loop on the bits set in the word, from the lowest one
+  while (word != 0) {
+
+    // Get the index of the line
+    unsigned int iLine = iLineFirst + __builtin_ctzll(word);
+
+    // Create the error
+    CBoError* error =
+      CBoErrorCreate(
+        that,
+        that->lineArr[iLine],
+        iLine + 1,
+        type);
+
+    // Add the error to the file
+    CBoFileAddError(
+      that,
+      error);
+
+    // Clear the lowest bit set
+    word &= word - 1;
+
+  }
+
+  // Return the flag
+  return noError;
+
+}
+
+// Function to add the CBoError 'error' to the CBoFile 'that'
+void CBoFileAddError(
+   CBoFile* const that,
+  CBoError* const error) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (error == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'error' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the file has already reached its maximum number of errors
+  if (CBoFileIsErrorBudgetSpent(that) == true) {
+
+    // Discard the error
+    CBoError* discarded = error;
+    CBoErrorFree(&discarded);
+    return;
+
+  }
+
+  // Add the error sorted on the line index
+  GSetAddSort(
+    &(that->errors),
+    error,
+    error->iLine);
+
+}
+
+// Display the errors of the CBoFile 'that' on the stream of the CBo
+// 'cbo'
+void CBoFilePrintErrors(
+  const CBoFile* const that,
+      const CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If there are errors
+  if (GSetNbElem(&(that->errors)) > 0) {
+
+    // Loop on errors
+    GSetIterForward iter = GSetIterForwardCreateStatic(&(that->errors));
+    do {
+
+      // Get the error
+      CBoError* error = GSetIterGet(&iter);
+
+      // Print the error
+      CBoErrorPrint(
+        error,
+        cbo);
+
+    } while(GSetIterStep(&iter));
+
+  }
+
+}
+
+// Function to create a new CBoLine from its content,
+// Return a pointer to the new CBoLine
+CBoLine* CBoLineCreate(const char* const str) {
+
+#if BUILDMODE == 0
+  if (str == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'str' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare the new CBoLine
+  CBoLine* that = (CBoLine*)malloc(sizeof(CBoLine));
+
+  if (that != NULL) {
+
+    // Copy the content
+    that->str = strdup(str);
+
+    // If we couldn't copy the content
+    if (that->str == NULL) {
+
+      free(that);
+      that = NULL;
+
+    }
+
+    // Init the indent level, the errors and the original index
+    that->indent = 0;
+    that->localErrors = 0;
+    that->iLineOrig = 0;
+
+  }
+
+  // Return the CBoLine
+  return that;
+
+}
+
+// Function to free the memory used by the CBoLine 'that'
+void CBoLineFree(CBoLine** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Free the line content
+  free((*that)->str);
+
+  // Free the CBoLine
+  free(*that);
+  *that = NULL;
+
+}
+
+// Function to create a new CBoError from its file, line, index of line
+// and type
+// Return a pointer to the new CBoError
+CBoError* CBoErrorCreate(
+      CBoFile* const file,
+      CBoLine* const line,
+  const unsigned int iLine,
+  const CBoErrorType type) {
+
+#if BUILDMODE == 0
+  if (file == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'file' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (line == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'line' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare the new CBoError
+  CBoError* that = (CBoError*)malloc(sizeof(CBoError));
+
+  if (that != NULL) {
+
+    // Init properties
+    that->file = file;
+    that->iLine = iLine;
+    that->line = line;
+    that->type = type;
+
+  }
+
+  // Return the CBoLine
+  return that;
+
+}
+
+// Function to free the memory used by the CBoError 'that'
+void CBoErrorFree(CBoError** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Free the CBoError
+  free(*that);
+  *that = NULL;
+
+}
+
+// Function to display the CBoError 'that' on the stream of the CBo
+// 'cbo'
+void CBoErrorPrint(
+  const CBoError* const that,
+       const CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the colors of the error message and the error line, if the
+  // output is colored
+  const char* colorMsg = "";
+  const char* colorLine = "";
+  const char* colorEnd = "";
+  if (cbo->flagColor == true) {
+
+    colorMsg = cboColorStart[CBoColor_error];
+    colorLine = cboColorStart[CBoColor_errorLine];
+    colorEnd = cboColorEnd;
+
+  }
+
+  // Print the error message and the error line, the stream is the
+  // buffer of the output of the file, which is written at once when
+  // the file is displayed
+  fprintf(
+    cbo->stream,
+    "%s%s:%u %s.%s\n%s%s%s\n",
+    colorMsg,
+    that->file->filePath,
+    that->iLine,
+    cboErrorTypeStr[that->type],
+    colorEnd,
+    colorLine,
+    that->line->str,
+    colorEnd);
+
+}
+
+// Check the CBoFile 'that' with the CBo 'cbo'
+// The rules write only on the stream of 'cbo', which must be owned by
+// the calling thread
+// Return true if there was no problem, else false
+bool CBoFileCheck(
+  CBoFile* const that,
+      CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If only a range of lines is checked, check it through a view of
+  // the lines around it
+  if (cbo->rangeFirstLine > 0) {
+
+    return
+      CBoFileCheckLines(
+        that,
+        cbo,
+        cbo->rangeFirstLine,
+        cbo->rangeLastLine);
+
+  }
+
+  // If the errors must be fixed or the file reindented, check the file
+  // through the fix
+  if (
+    cbo->flagFix == true ||
+    cbo->flagReindent == true) {
+
+    return
+      CBoFileCheckFix(
+        that,
+        cbo);
+
+  }
+
+  // If the user hasn't requested to display only the list of
+  // file(s) with error(s) and the output is displayed
+  if (
+    cbo->flagListFileError == false &&
+    cbo->stream != NULL) {
+
+    // Display an info message, colored if the output is colored
+    fprintf(
+      cbo->stream,
+      "%s=== Check file [%s] as %s ===%s\n",
+      (cbo->flagColor == true ? cboColorStart[CBoColor_fileHeader] : ""),
+      that->filePath,
+      cboFileTypeStr[that->type],
+      (cbo->flagColor == true ? cboColorEnd : ""));
+
+  }
+
+  // Declare a variable to memorize the success
+  bool success = true;
+
+  // Set the maximum number of errors of the file, if we only need to
+  // know if the file has errors the first one is enough
+  that->nbMaxError = cbo->nbMaxErrorPerFile;
+  if (
+    cbo->flagFirstError == true ||
+    cbo->flagListFileError == true) {
+
+    that->nbMaxError = 1;
+
+  }
+
+  // If there is a baseline, the known errors must not spend the budget
+  // of errors, the maximum is applied with the baseline after the check
+  unsigned int nbMaxError = that->nbMaxError;
+  if (cbo->baseline != NULL) {
+
+    that->nbMaxError = 0;
+
+  }
+
+  // Check the rules according to the type of file
+  if (
+    that->type == CBoFileType_C_header ||
+    that->type == CBoFileType_C_body) {
+
+    // Calculate the errors of the line local rules
+    CBoFileUpdateLocalErrors(
+      that,
+      cbo);
+
+    // Get the order of check of the rules
+    const unsigned int* order = cbo->ruleOrder;
+
+    // If the file is big enough and there is no maximum number of
+    // errors, which would make the rules depend on each other, check
+    // all the rules in parallel, their results are merged below in
+    // the order of the schedule
+    CBoRuleRun* runs = NULL;
+    if (
+      cbo->nbLineParallelRules > 0 &&
+      GSetNbElem(&(that->lines)) >= cbo->nbLineParallelRules &&
+      that->nbMaxError == 0) {
+
+      runs =
+        CBoFileRunRulesParallel(
+          that,
+          cbo);
+
+    }
+
+    // Declare a variable to memorize the failed or skipped rules, some
+    // may have failed before the check
+    unsigned int failedRules = that->failedRules;
+
+    // Loop on the rules until the maximum number of errors is reached
+    for (
+      unsigned int iRule = 0;
+      iRule < CBoRuleId_nb &&
+      CBoFileIsErrorBudgetSpent(that) == false;
+      ++iRule) {
+
+      // Get the rule
+      const CBoRule* rule = cboRules + order[iRule];
+
+      // If one of the prerequisites of the rule has failed
+      if ((rule->prerequisites & failedRules) != 0) {
+
+        // Skip the rule, and consider it has failed for the rules
+        // depending on it
+        failedRules |= (1u << order[iRule]);
+        if (cbo->stream != NULL) {
+
+          fprintf(
+            cbo->stream,
+            "%s skipped\n",
+            rule->label);
+
+        }
+
+      // Else, the rule can be checked
+      } else {
+
+        // Report the progress of the check of the file, if it's
+        // displayed, once per rule out of the loops of the rules on
+        // the lines
+        if (cbo->progress != NULL) {
+
+          CBoProgressSetRule(
+            cbo->progress,
+            rule->label,
+            iRule,
+            CBoRuleId_nb);
+
+        }
+
+        // Check the rule, or get its result if it was checked in
+        // parallel
+        bool ret = true;
+        if (runs != NULL) {
+
+          ret =
+            CBoFileMergeRuleRun(
+              that,
+              cbo,
+              runs + order[iRule]);
+
+        } else {
+
+          ret =
+            rule->check(
+              that,
+              cbo);
+
+        }
+
+        // If the rule has failed
+        if (ret == false) {
+
+          // Update the success flag and the failed rules
+          success = false;
+          failedRules |= (1u << order[iRule]);
+
+        }
+
+      }
+
+    }
+
+    // Free the results of the rules checked in parallel
+    CBoRuleRunsFree(&runs);
+
+  }
+
+  // If there is a baseline, remove the known errors, the file is correct
+  // if it has no other error
+  if (
+    cbo->baseline != NULL &&
+    success == false) {
+
+    success =
+      CBoFileApplyBaseline(
+        that,
+        cbo,
+        nbMaxError);
+
+  }
+
+  // Return the successfull code
+  return success;
+
+}
+
+// Check the lines 'iFirstLine' to 'iLastLine' (from 1) of the CBoFile
+// 'that' with the CBo 'cbo'. The rules are checked on a view of the
+// lines from the top level item containing the first line to the one
+// after the last line, whose indentation levels are calculated from
+// the nearest checkpoint, and only the errors of the range are kept.
+// The rules whose prerequisites fail on the whole file are skipped
+// Return true if there was no problem in the range, else false
+bool CBoFileCheckLines(
+      CBoFile* const that,
+          CBo* const cbo,
+  const unsigned int iFirstLine,
+  const unsigned int iLastLine) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the number of lines, and the last line of the range in the file
+  unsigned int nbLine = GSetNbElem(&(that->lines));
+  unsigned int iLast = (iLastLine < nbLine ? iLastLine : nbLine);
+
+  // If the range is not in the file, or the indentation levels haven't
+  // been calculated, there is nothing to check
+  if (
+    iFirstLine == 0 ||
+    iFirstLine > iLast ||
+    that->indentCheckpoints == NULL) {
+
+    return true;
+
+  }
+
+  // Get the index of the line before the range, the view starts at the
+  // last boundary up to it, searched from the nearest checkpoint and
+  // then from the previous ones until a boundary is found, so the cost
+  // depends on the size of the top level item and not of the file
+  unsigned int iBefore = (iFirstLine >= 2 ? iFirstLine - 2 : 0);
+  unsigned int iStart = 0;
+  CBoIndentState stateStart = that->indentCheckpoints[0];
+  bool isFound = (iBefore == 0);
+  unsigned int iCheckpoint = iBefore / CBOFILE_INDENT_NB_LINE_CHECKPOINT;
+  while (isFound == false) {
+
+    // Loop on the lines from the checkpoint up to the line before the
+    // range or the next checkpoint
+    CBoIndentState state = that->indentCheckpoints[iCheckpoint];
+    for (
+      unsigned int iLine = iCheckpoint * CBOFILE_INDENT_NB_LINE_CHECKPOINT;
+      iLine <= iBefore &&
+      iLine < (iCheckpoint + 1) * CBOFILE_INDENT_NB_LINE_CHECKPOINT;
+      ++iLine) {
+
+      // Memorize the line if it's a boundary, with its state
+      if (
+        CBoFileIsRangeBoundary(
+          that,
+          iLine,
+          &state) == true) {
+
+        iStart = iLine;
+        stateStart = state;
+        isFound = true;
+
+      }
+
+      CBoIndentStateStep(
+        &state,
+        CBoFileGetIndentLineProp(
+          that,
+          iLine));
+
+    }
+
+    // If there is no boundary, move to the previous checkpoint, the
+    // first line of the file is the boundary of the first one
+    if (isFound == false) {
+
+      if (iCheckpoint == 0) {
+
+        isFound = true;
+
+      } else {
+
+        --iCheckpoint;
+
+      }
+
+    }
+
+  }
+
+  // Calculate the indentation levels of the lines from the start of the
+  // view, up to the first boundary after the range, which ends the view
+  CBoIndentState state = stateStart;
+  unsigned int iEnd = iStart;
+  bool isEnd = false;
+  while (
+    iEnd < nbLine &&
+    isEnd == false) {
+
+    isEnd = (
+      iEnd >= iLast &&
+      CBoFileIsRangeBoundary(
+        that,
+        iEnd,
+        &state) == true);
+    that->lineArr[iEnd]->indent =
+      CBoIndentStateStep(
+        &state,
+        CBoFileGetIndentLineProp(
+          that,
+          iEnd));
+    ++iEnd;
+
+  }
+
+  // Create the view, a copy of the file sharing the lines of the view
+  // with its own set of lines, errors and properties of the lines
+  CBoFile view = *that;
+  view.lines = GSetCreateStatic();
+  view.errors = GSetCreateStatic();
+  view.lineArr = NULL;
+  view.lineFlags[0] = NULL;
+  view.suppressed = NULL;
+  view.strOrig = NULL;
+  view.indentCheckpoints = NULL;
+  view.nbIndentCheckpoint = 0;
+  for (
+    unsigned int iLine = iStart;
+    iLine < iEnd;
+    ++iLine) {
+
+    GSetAppend(
+      &(view.lines),
+      that->lineArr[iLine]);
+
+  }
+
+  CBoFileUpdateLineFlags(&view);
+
+  // The rules are skipped as in the check of the whole file, if one of
+  // their prerequisites fails on the whole file, even out of the view
+  view.failedRules =
+    CBoFileGetFailedPrerequisites(
+      that,
+      cbo);
+
+  // The suppression comments before the view still apply, get the
+  // suppressed error types of the lines from the file
+  free(view.suppressed);
+  view.suppressed = NULL;
+  if (that->suppressed != NULL) {
+
+    for (
+      unsigned int iLine = iStart;
+      iLine < iEnd;
+      ++iLine) {
+
+      unsigned int types = 0;
+      for (
+        unsigned int iType = 0;
+        iType < CBoErrorType_nb;
+        ++iType) {
+
+        if (
+          CBoFileIsSuppressed(
+            that,
+            iLine,
+            (CBoErrorType)iType) == true) {
+
+          types |= (1u << iType);
+
+        }
+
+      }
+
+      if (types != 0) {
+
+        CBoFileSuppressLine(
+          &view,
+          iLine - iStart,
+          types);
+
+      }
+
+    }
+
+  }
+
+  // Check the view without limit on the number of errors, as the ones
+  // outside the range must not spend the budget, with its output in a
+  // buffer, only if it's displayed
+  char* log = NULL;
+  size_t logSize = 0;
+  CBo cboView = *cbo;
+  cboView.rangeFirstLine = 0;
+  cboView.rangeLastLine = 0;
+  cboView.flagFirstError = false;
+  cboView.flagListFileError = false;
+  cboView.nbMaxErrorPerFile = 0;
+  cboView.stream = NULL;
+  if (
+    cbo->flagListFileError == false &&
+    cbo->stream != NULL) {
+
+    cboView.stream =
+      open_memstream(
+        &log,
+        &logSize);
+    if (cboView.stream == NULL) {
+
+      cbo->err->_type = PBErrTypeIOError;
+      sprintf(
+        cbo->err->_msg,
+        "Failed to open the output stream of [%s]",
+        that->filePath);
+      PBErrCatch(cbo->err);
+
+    }
+
+  }
+
+  CBoFileCheck(
+    &view,
+    &cboView);
+
+  // Display the output of the check
+  if (cboView.stream != NULL) {
+
+    fclose(cboView.stream);
+    fwrite(
+      log,
+      1,
+      logSize,
+      cbo->stream);
+    free(log);
+
+  }
+
+  // Set the maximum number of errors of the file as in the check of the
+  // whole file
+  that->nbMaxError = cbo->nbMaxErrorPerFile;
+  if (
+    cbo->flagFirstError == true ||
+    cbo->flagListFileError == true) {
+
+    that->nbMaxError = 1;
+
+  }
+
+  // Move the errors of the range to the file with the index of their
+  // line in the file, and free the other ones
+  while (GSetNbElem(&(view.errors)) > 0) {
+
+    CBoError* error = GSetPop(&(view.errors));
+    unsigned int iLine = error->iLine + iStart;
+    if (
+      iLine >= iFirstLine &&
+      iLine <= iLast) {
+
+      error->file = that;
+      error->iLine = iLine;
+      CBoFileAddError(
+        that,
+        error);
+
+    } else {
+
+      CBoErrorFree(&error);
+
+    }
+
+  }
+
+  // Free the view, its lines belong to the file
+  GSetFlush(&(view.lines));
+  free(view.lineArr);
+  free(view.lineFlags[0]);
+  free(view.suppressed);
+
+  // Return the successfull code
+  return (GSetNbElem(&(that->errors)) == 0);
+
+}
+
+// Check on the whole CBoFile 'that' with the CBo 'cbo' the rules which
+// are prerequisites of other rules, without output and stopping each
+// rule at its first error, the errors are freed
+// Return the mask of the failed rules (1 << CBoRuleId)
+unsigned int CBoFileGetFailedPrerequisites(
+  CBoFile* const that,
+      CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the mask of the rules which are prerequisites of other rules
+  unsigned int prerequisites = 0;
+  for (
+    unsigned int iRule = 0;
+    iRule < CBoRuleId_nb;
+    ++iRule) {
+
+    prerequisites |= cboRules[iRule].prerequisites;
+
+  }
+
+  // Calculate the errors of the line local rules on the whole file
+  CBoFileUpdateLocalErrors(
+    that,
+    cbo);
+
+  // Check the rules without output, one error is enough to know the
+  // rule has failed
+  CBo cboPrerequisite = *cbo;
+  cboPrerequisite.stream = NULL;
+  unsigned int nbMaxError = that->nbMaxError;
+  that->nbMaxError = 1;
+
+  // Loop on the rules in their order of check
+  unsigned int failedRules = 0;
+  for (
+    unsigned int iRule = 0;
+    iRule < CBoRuleId_nb;
+    ++iRule) {
+
+    // Get the rule, if it's a prerequisite of another one
+    unsigned int iRuleOrdered = cbo->ruleOrder[iRule];
+    const CBoRule* rule = cboRules + iRuleOrdered;
+    if ((prerequisites & (1u << iRuleOrdered)) != 0) {
+
+      // The rule fails if one of its own prerequisites has failed, as
+      // it's skipped, or if it fails on the file
+      if (
+        (rule->prerequisites & failedRules) != 0 ||
+        rule->check(
+          that,
+          &cboPrerequisite) == false) {
+
+        failedRules |= (1u << iRuleOrdered);
+
+      }
+
+      // Free the errors of the rule
+      while (GSetNbElem(&(that->errors)) > 0) {
+
+        CBoError* error = GSetPop(&(that->errors));
+        CBoErrorFree(&error);
+
+      }
+
+    }
+
+  }
+
+  // Restore the maximum number of errors of the file
+  that->nbMaxError = nbMaxError;
+
+  // Return the failed rules
+  return failedRules;
+
+}
+
+// Check if the line 'iLine' of the CBoFile 'that', whose state of the
+// calculation of the indentation levels at its start is 'state', is a
+// boundary of the view of a range check: a line at the top level,
+// starting on the first column and not a precompiler command, the
+// rules can be checked from it without the lines before it
+// Return true if it's a boundary, else false
+bool CBoFileIsRangeBoundary(
+         const CBoFile* const that,
+           const unsigned int iLine,
+  const CBoIndentState* const state) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (state == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'state' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the line
+  const CBoLine* line = that->lineArr[iLine];
+
+  // Check the line
+  bool isBoundary = (
+    state->indent == 0 &&
+    state->flags == 0 &&
+    line->str[0] != '\0' &&
+    line->str[0] != ' ' &&
+    line->str[0] != '\t' &&
+    CBoFileIsLinePrecompilCmd(
+      that,
+      iLine) == false);
+
+  // Return the flag
+  return isBoundary;
+
+}
+
+// Check the CBoFile 'that' with the CBo 'cbo' and fix its errors of
+// the mechanical rules, the output is the one of the check of the
+// fixed file
+// Return true if there was no problem in the fixed file, else false
+bool CBoFileCheckFix(
+  CBoFile* const that,
+      CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Create a copy of the CBo checking the file without fixing it and
+  // without limit on the number of errors, all the errors must be
+  // known to be fixed
+  CBo cboFix = *cbo;
+  cboFix.flagFix = false;
+  cboFix.flagReindent = false;
+  cboFix.flagFirstError = false;
+  cboFix.flagListFileError = false;
+  cboFix.nbMaxErrorPerFile = 0;
+
+  // If the options of the CBo don't limit the number of errors, the
+  // output of the last check of the fixes is the one of the check
+  bool isSameCheck = (
+    cbo->flagFirstError == false &&
+    cbo->flagListFileError == false &&
+    cbo->nbMaxErrorPerFile == 0);
+
+  // The output of the checks of the fixes is kept only if it's the one
+  // displayed
+  bool isLogged = (
+    isSameCheck == true &&
+    cbo->flagFixDiff == false &&
+    cbo->stream != NULL);
+
+  // Get the kinds of fix applied by the CBo
+  unsigned int kinds = CBoGetFixKinds(cbo);
+
+  // If the diff of the fixes is displayed, memorize the original index
+  // of the lines, the original content of the changed lines is kept by
+  // the fixes
+  if (cbo->flagFixDiff == true) {
+
+    that->nbLineOrig = GSetNbElem(&(that->lines));
+    that->strOrig =
+      PBErrMalloc(
+        cbo->err,
+        sizeof(char*) * (that->nbLineOrig + 1));
+    memset(
+      that->strOrig,
+      0,
+      sizeof(char*) * (that->nbLineOrig + 1));
+    for (
+      unsigned int iLine = 0;
+      iLine < that->nbLineOrig;
+      ++iLine) {
+
+      that->lineArr[iLine]->iLineOrig = iLine + 1;
+
+    }
+
+  }
+
+  // Declare a variable to memorize the output of the check
+  char* log = NULL;
+  size_t logSize = 0;
+
+  // Loop on the passes of fixes until there is no more fixable error
+  // or the fixes change nothing, the first pass only checks the file,
+  // the other ones check it again after the fixes which free its
+  // errors
+  bool success = true;
+  bool successInit = true;
+  bool isFixed = false;
+  bool isChanged = true;
+  unsigned int nbFixableInit = 0;
+  unsigned int nbFixable = 0;
+  for (
+    unsigned int iPass = 0;
+    iPass <= CBO_FIX_NB_MAX_PASS &&
+    isChanged == true &&
+    (iPass == 0 || nbFixable > 0);
+    ++iPass) {
+
+    // Apply the fixes of the previous check
+    if (iPass > 0) {
+
+      isChanged =
+        CBoFileApplyFixes(
+          that,
+          cbo);
+      isFixed |= isChanged;
+
+    }
+
+    // Check the file, with its output in a new buffer if it's the one
+    // displayed
+    free(log);
+    log = NULL;
+    logSize = 0;
+    cboFix.stream = NULL;
+    if (isLogged == true) {
+
+      cboFix.stream =
+        open_memstream(
+          &log,
+          &logSize);
+      if (cboFix.stream == NULL) {
+
+        cbo->err->_type = PBErrTypeIOError;
+        sprintf(
+          cbo->err->_msg,
+          "Failed to open the output stream of [%s]",
+          that->filePath);
+        PBErrCatch(cbo->err);
+
+      }
+
+    }
+
+    success =
+      CBoFileCheck(
+        that,
+        &cboFix);
+    if (cboFix.stream != NULL) {
+
+      fclose(cboFix.stream);
+
+    }
+
+    // Get the number of fixable errors
+    nbFixable =
+      CBoFileGetNbFixableError(
+        that,
+        kinds);
+    if (iPass == 0) {
+
+      nbFixableInit = nbFixable;
+      successInit = success;
+
+    }
+
+  }
+
+  // If the diff of the fixes is displayed, it's the only output, and
+  // the result is the one of the file, which is not changed
+  if (cbo->flagFixDiff == true) {
+
+    if (isFixed == true && cbo->stream != NULL) {
+
+      CBoFilePrintFixDiff(
+        that,
+        cbo->stream);
+
+    }
+
+    for (
+      unsigned int iLine = 0;
+      iLine < that->nbLineOrig;
+      ++iLine) {
+
+      free(that->strOrig[iLine]);
+
+    }
+
+    free(that->strOrig);
+    that->strOrig = NULL;
+    success = successInit;
+
+  // Else, if the output of the last check is the one of the check,
+  // display it
+  } else if (isSameCheck == true) {
+
+    if (logSize > 0) {
+
+      fwrite(
+        log,
+        1,
+        logSize,
+        cbo->stream);
+
+    }
+
+  // Else, check the fixed file again with the options of the CBo
+  } else {
+
+    while (GSetNbElem(&(that->errors)) > 0) {
+
+      CBoError* error = GSetPop(&(that->errors));
+      CBoErrorFree(&error);
+
+    }
+
+    CBo cboCheck = *cbo;
+    cboCheck.flagFix = false;
+    cboCheck.flagReindent = false;
+    success =
+      CBoFileCheck(
+        that,
+        &cboCheck);
+
+  }
+
+  free(log);
+
+  // If the file has been fixed and the fixes are not only displayed
+  if (
+    isFixed == true &&
+    cbo->flagFixDiff == false) {
+
+    // Replace the file with its fixed lines
+    bool isSaved = CBoFileSave(that);
+
+    // Display the number of fixed errors, or the failure
+    if (isSaved == false && cbo->stream != NULL) {
+
+      fprintf(
+        cbo->stream,
+        "Failed to save the fixed file [%s]\n",
+        that->filePath);
+      success = false;
+
+    } else if (isSaved == false) {
+
+      success = false;
+
+    } else if (
+      cbo->flagListFileError == false &&
+      cbo->stream != NULL) {
+
+      fprintf(
+        cbo->stream,
+        "Fixed %u error(s)\n",
+        (nbFixable < nbFixableInit ? nbFixableInit - nbFixable : 0));
+
+    }
+
+  }
+
+  // Return the successfull code
+  return success;
+
+}
+
+// Get the kinds of fix applied by the CBo 'that'
+// Return the mask of CBoFixKind
+unsigned int CBoGetFixKinds(const CBo* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the kinds of fix
+  unsigned int kinds = CBoFixKind_none;
+
+  // The errors of the mechanical rules are fixed with --fix
+  if (that->flagFix == true) {
+
+    kinds |= CBoFixKind_content | CBoFixKind_insert | CBoFixKind_remove;
+
+  }
+
+  // The indentation is rewritten with --reindent
+  if (that->flagReindent == true) {
+
+    kinds |= CBoFixKind_indent;
+
+  }
+
+  // Return the kinds of fix
+  return kinds;
+
+}
+
+// Get the number of errors of the CBoFile 'that' which can be fixed
+// with the kinds of fix in the mask of CBoFixKind 'kinds'
+// Return the number of errors
+unsigned int CBoFileGetNbFixableError(
+  const CBoFile* const that,
+    const unsigned int kinds) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the number of errors
+  unsigned int nb = 0;
+
+  // Loop on the errors
+  if (GSetNbElem(&(that->errors)) > 0) {
+
+    GSetIterForward iter =
+      GSetIterForwardCreateStatic(&(that->errors));
+    do {
+
+      // If the error can be fixed, count it
+      CBoError* error = GSetIterGet(&iter);
+      if (
+        CBoErrorIsFixable(
+          error,
+          kinds) == true) {
+
+        ++nb;
+
+      }
+
+    } while (GSetIterStep(&iter));
+
+  }
+
+  // Return the number of errors
+  return nb;
+
+}
+
+// Check if the CBoError 'that' can be fixed with the kinds of fix in
+// the mask of CBoFixKind 'kinds'. A semicolon at the head of its line
+// can't be moved without joining the lines, its error is not fixable
+// Return true if it can be fixed, else false
+bool CBoErrorIsFixable(
+  const CBoError* const that,
+     const unsigned int kinds) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // If the type of the error is not fixed with these kinds of fix
+  if ((cboErrorTypeFix[that->type] & kinds) == 0) {
+
+    return false;
+
+  }
+
+  // If it's a semicolon at the head of the line, only the spaces
+  // between the code and a semicolon are removed
+  if (that->type == CBoErrorType_SpaceAroundSemicolon) {
+
+    unsigned int posHead = CBoLineGetPosHead(that->line);
+    if (
+      posHead < CBoLineGetLength(that->line) &&
+      that->line->str[posHead] == ';') {
+
+      return false;
+
+    }
+
+  }
+
+  // If we reach here the error can be fixed
+  return true;
+
+}
+
+// Apply the fixes of the errors of the CBoFile 'that' on its lines, in
+// one pass on the lines, and update the properties of the lines with
+// the threads of the CBo 'cbo', the errors are freed
+// Return true if a line was changed, else false
+bool CBoFileApplyFixes(
+  CBoFile* const that,
+      CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the number of lines and the kinds of fix applied by the CBo
+  unsigned int nbLine = GSetNbElem(&(that->lines));
+  unsigned int kindsFix = CBoGetFixKinds(cbo);
+
+  // Get the mask (1 << CBoErrorType) of the fixable errors of each
+  // line, and free the errors
+  unsigned int* lineTypes =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(unsigned int) * (nbLine + 1));
+  memset(
+    lineTypes,
+    0,
+    sizeof(unsigned int) * (nbLine + 1));
+  while (GSetNbElem(&(that->errors)) > 0) {
+
+    CBoError* error = GSetPop(&(that->errors));
+    if (
+      CBoErrorIsFixable(
+        error,
+        kindsFix) == true) {
+
+      lineTypes[error->iLine - 1] |= (1u << error->type);
+
+    }
+
+    CBoErrorFree(&error);
+
+  }
+
+  // Get the position of the head of each line once fixed, from the
+  // last line as a comment is indented as its next line, and the other
+  // lines at their computed indentation level
+  unsigned int* heads =
+    PBErrMalloc(
+      cbo->err,
+      sizeof(unsigned int) * (nbLine + 1));
+  memset(
+    heads,
+    0,
+    sizeof(unsigned int) * (nbLine + 1));
+  for (
+    unsigned int iLine = nbLine;
+    iLine > 0;
+    --iLine) {
+
+    CBoLine* line = that->lineArr[iLine - 1];
+    heads[iLine - 1] = CBoLineGetPosHead(line);
+    if ((lineTypes[iLine - 1] & (1u << CBoErrorType_IndentLevel)) != 0) {
+
+      heads[iLine - 1] = (
+        CBoLineIsComment(line) == true ?
+        heads[iLine] :
+        line->indent);
+
+    }
+
+  }
+
+  // Declare a variable to memorize if a line has changed
+  bool isChanged = false;
+
+  // Empty the set of lines, the lines are still in the array of lines,
+  // and loop on the lines to add them back with their fixes
+  GSetFlush(&(that->lines));
+  for (
+    unsigned int iLine = 0;
+    iLine < nbLine;
+    ++iLine) {
+
+    // Get the line and the kinds of fix of its errors
+    CBoLine* line = that->lineArr[iLine];
+    unsigned int kinds = 0;
+    unsigned int typesLeft = lineTypes[iLine];
+    while (typesLeft != 0) {
+
+      kinds |= cboErrorTypeFix[__builtin_ctz(typesLeft)];
+      typesLeft &= typesLeft - 1;
+
+    }
+
+    // If the line must be removed, free it, except its original
+    // content if it's kept
+    if ((kinds & CBoFixKind_remove) != 0) {
+
+      if (
+        CBoFileKeepStrOrig(
+          that,
+          line) == true) {
+
+        line->str = NULL;
+
+      }
+
+      CBoLineFree(&line);
+      isChanged = true;
+
+    // Else, the line is kept
+    } else {
+
+      // If an empty line must be inserted before the line, add it
+      if ((kinds & CBoFixKind_insert) != 0) {
+
+        CBoLine* emptyLine = CBoLineCreate("");
+        if (emptyLine != NULL) {
+
+          GSetAppend(
+            &(that->lines),
+            emptyLine);
+          isChanged = true;
+
+        }
+
+      }
+
+      // If the content or the indentation of the line must be fixed
+      if ((kinds & (CBoFixKind_content | CBoFixKind_indent)) != 0) {
+
+        // Get the fixed content, and replace the content of the line
+        // if it has changed
+        char* str =
+          CBoLineGetFixedStr(
+            line,
+            lineTypes[iLine],
+            heads[iLine],
+            cbo->err);
+        bool isSame =
+          (strcmp(
+            str,
+            line->str) == 0);
+        if (isSame == false) {
+
+          if (
+            CBoFileKeepStrOrig(
+              that,
+              line) == false) {
+
+            free(line->str);
+
+          }
+
+          line->str = str;
+          isChanged = true;
+
+        } else {
+
+          free(str);
+
+        }
+
+      }
+
+      // Add the line
+      GSetAppend(
+        &(that->lines),
+        line);
+
+    }
+
+  }
+
+  free(lineTypes);
+  free(heads);
+
+  // Free the array of lines and the bitsets, and calculate them again
+  // with the properties and the indentation levels of the new lines
+  free(that->lineArr);
+  that->lineArr = NULL;
+  free(that->lineFlags[0]);
+  that->lineFlags[0] = NULL;
+  free(that->suppressed);
+  that->suppressed = NULL;
+  CBoFileUpdateLineFlags(that);
+  CBoFileUpdateIndentLvlLines(
+    that,
+    cbo->nbThread);
+
+  // Return the flag
+  return isChanged;
+
+}
+
+// Get the content of the line 'that' fixed for the error types in the
+// mask (1 << CBoErrorType) 'types', its indentation is made of 'head'
+// spaces if IndentLevel is in the mask. The allocation failures are
+// reported on 'err'
+// Return the fixed content, to be freed by the caller
+char* CBoLineGetFixedStr(
+  const CBoLine* const that,
+    const unsigned int types,
+    const unsigned int head,
+          PBErr* const err) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (err == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'err' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the length and the position of the head of the line
+  unsigned int length = CBoLineGetLength(that);
+  unsigned int posHead = CBoLineGetPosHead(that);
+
+  // Allocate memory for the fixed content, a tab becomes at most
+  // CBOLINE_INDENT_SIZE spaces and a space is added at most after each
+  // char
+  char* str =
+    PBErrMalloc(
+      err,
+      length * (CBOLINE_INDENT_SIZE + 2) + head + 1);
+  unsigned int nb = 0;
+
+  // If the line is reindented, its indentation is made of spaces up to
+  // the head
+  bool isIndentFixed = ((types & (1u << CBoErrorType_IndentLevel)) != 0);
+  if (isIndentFixed == true) {
+
+    memset(
+      str,
+      ' ',
+      head);
+    nb = head;
+
+  }
+
+  // Copy the indentation, replacing the tabs by spaces if needed
+  bool isTabFixed = ((types & (1u << CBoErrorType_IndentTab)) != 0);
+  for (
+    unsigned int iChar = 0;
+    iChar < posHead &&
+    isIndentFixed == false;
+    ++iChar) {
+
+    if (
+      isTabFixed == true &&
+      that->str[iChar] == '\t') {
+
+      for (
+        unsigned int iSpace = 0;
+        iSpace < CBOLINE_INDENT_SIZE;
+        ++iSpace) {
+
+        str[nb] = ' ';
+        ++nb;
+
+      }
+
+    } else {
+
+      str[nb] = that->str[iChar];
+      ++nb;
+
+    }
+
+  }
+
+  // Memorize the end of the indentation, the spaces before a comma or
+  // semicolon are removed up to it
+  unsigned int nbIndent = nb;
+
+  // Get the fixed rules, the commas are not checked in comments
+  bool isCommaFixed = (
+    (types & (1u << CBoErrorType_SpaceAroundComma)) != 0 &&
+    CBoLineIsComment(that) == false);
+  bool isSemicolonFixed =
+    ((types & (1u << CBoErrorType_SpaceAroundSemicolon)) != 0);
+
+  // Declare two flags to memorize the strings in the code, updated as
+  // in the check of the rules
+  bool flagQuote = false;
+  bool flagDoubleQuote = false;
+
+  // Loop on the char of the line after the indentation
+  for (
+    unsigned int iChar = posHead;
+    iChar < length;
+    ++iChar) {
+
+    // Update the flags of the strings
+    char c = that->str[iChar];
+    if (
+      c == '\'' &&
+      flagDoubleQuote == false) {
+
+      flagQuote = !flagQuote;
+
+    } else if (
+      c == '"' &&
+      flagQuote == false) {
+
+      flagDoubleQuote = !flagDoubleQuote;
+
+    }
+
+    // Check if the char is a comma or a semicolon to fix
+    bool isInCode = (flagQuote == false && flagDoubleQuote == false);
+    bool isComma = (isInCode == true && isCommaFixed == true && c == ',');
+    bool isSemicolon = (
+      isInCode == true &&
+      isSemicolonFixed == true &&
+      c == ';');
+
+    // If it's a comma or semicolon to fix, remove the spaces before it
+    if (
+      isComma == true ||
+      isSemicolon == true) {
+
+      while (
+        nb > nbIndent &&
+        (str[nb - 1] == ' ' || str[nb - 1] == '\t')) {
+
+        --nb;
+
+      }
+
+    }
+
+    // Copy the char
+    str[nb] = c;
+    ++nb;
+
+    // If it's a comma to fix and it's not at the end of the line, it
+    // must be followed by a space, which replaces a tab
+    if (
+      isComma == true &&
+      iChar + 1 < length &&
+      that->str[iChar + 1] != ' ') {
+
+      if (that->str[iChar + 1] == '\t') {
+
+        ++iChar;
+
+      }
+
+      str[nb] = ' ';
+      ++nb;
+
+    }
+
+  }
+
+  // Remove the trailing spaces if needed
+  if ((types & (1u << CBoErrorType_TrailingSpace)) != 0) {
+
+    while (
+      nb > 0 &&
+      (str[nb - 1] == ' ' || str[nb - 1] == '\t')) {
+
+      --nb;
+
+    }
+
+  }
+
+  // Return the fixed content
+  str[nb] = '\0';
+  return str;
+
+}
+
+// Keep the content of the line 'line' as its original content in the
+// CBoFile 'that', if the original contents are kept and it's the first
+// change of the line
+// Return true if the content was kept, else false
+bool CBoFileKeepStrOrig(
+        CBoFile* const that,
+  const CBoLine* const line) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (line == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'line' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Check if the content must be kept, the lines inserted by the fixes
+  // have no original content
+  bool isKept = (
+    that->strOrig != NULL &&
+    line->iLineOrig > 0 &&
+    that->strOrig[line->iLineOrig - 1] == NULL);
+
+  // Keep the content if needed
+  if (isKept == true) {
+
+    that->strOrig[line->iLineOrig - 1] = line->str;
+
+  }
+
+  // Return the flag
+  return isKept;
+
+}
+
+// Print on the stream 'stream' the unified diff of the fixes of the
+// CBoFile 'that', from the original content of its changed lines
+void CBoFilePrintFixDiff(
+  const CBoFile* const that,
+           FILE* const stream) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (stream == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'stream' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the number of lines of the original and fixed files
+  unsigned int nbLineOrig = that->nbLineOrig;
+  unsigned int nbLineFixed = GSetNbElem(&(that->lines));
+
+  // If there are original content and lines
+  if (
+    that->strOrig != NULL &&
+    nbLineOrig > 0 &&
+    nbLineFixed > 0) {
+
+    // Get the last line of the original file, which is the last line of
+    // the fixed file if it hasn't changed
+    const char* lastOrig = that->strOrig[nbLineOrig - 1];
+    if (lastOrig == NULL) {
+
+      lastOrig = that->lineArr[nbLineFixed - 1]->str;
+
+    }
+
+    // If a file ends with a newline its last line is empty and is not a
+    // line of the diff, else the last line has no newline
+    unsigned int iEndOrig = nbLineOrig;
+    if (lastOrig[0] == '\0') {
+
+      iEndOrig = 0;
+      --nbLineOrig;
+
+    }
+
+    unsigned int iEndFixed = nbLineFixed;
+    if (that->lineArr[nbLineFixed - 1]->str[0] == '\0') {
+
+      iEndFixed = 0;
+      --nbLineFixed;
+
+    }
+
+    // Create the lines of the diff, in the order of the fixed lines
+    // with the original lines removed before them, a changed line is
+    // removed and added
+    CBoDiffLine* diffLines =
+      PBErrMalloc(
+        that->err,
+        sizeof(CBoDiffLine) * (that->nbLineOrig + nbLineFixed + 2));
+    unsigned int nb = 0;
+    unsigned int iOrig = 0;
+    for (
+      unsigned int iFixed = 0;
+      iFixed <= GSetNbElem(&(that->lines));
+      ++iFixed) {
+
+      // Get the original index of the line, the one after the last
+      // original line after the last fixed line
+      unsigned int iLineOrig = that->nbLineOrig + 1;
+      const char* str = NULL;
+      if (iFixed < GSetNbElem(&(that->lines))) {
+
+        iLineOrig = that->lineArr[iFixed]->iLineOrig;
+        str = that->lineArr[iFixed]->str;
+
+      }
+
+      // Add the original lines removed before the line
+      while (
+        iLineOrig > 0 &&
+        iOrig + 1 < iLineOrig) {
+
+        diffLines[nb].str = that->strOrig[iOrig];
+        diffLines[nb].iOrig = iOrig + 1;
+        diffLines[nb].iFixed = 0;
+        ++nb;
+        ++iOrig;
+
+      }
+
+      if (iLineOrig > 0) {
+
+        iOrig = iLineOrig;
+
+      }
+
+      // If the line was changed, add its original content
+      if (
+        str != NULL &&
+        iLineOrig > 0 &&
+        that->strOrig[iLineOrig - 1] != NULL &&
+        strcmp(
+          that->strOrig[iLineOrig - 1],
+          str) != 0) {
+
+        diffLines[nb].str = that->strOrig[iLineOrig - 1];
+        diffLines[nb].iOrig = iLineOrig;
+        diffLines[nb].iFixed = 0;
+        ++nb;
+        iLineOrig = 0;
+
+      }
+
+      // Add the line, as a line of both files if it's unchanged
+      if (str != NULL) {
+
+        diffLines[nb].str = str;
+        diffLines[nb].iOrig = iLineOrig;
+        diffLines[nb].iFixed = iFixed + 1;
+        ++nb;
+
+      }
+
+    }
+
+    // Remove the empty last lines of the files ending with a newline
+    unsigned int nbKept = 0;
+    for (
+      unsigned int iLine = 0;
+      iLine < nb;
+      ++iLine) {
+
+      CBoDiffLine diffLine = diffLines[iLine];
+      if (diffLine.iOrig > nbLineOrig) {
+
+        diffLine.iOrig = 0;
+
+      }
+
+      if (diffLine.iFixed > nbLineFixed) {
+
+        diffLine.iFixed = 0;
+
+      }
+
+      if (
+        diffLine.iOrig > 0 ||
+        diffLine.iFixed > 0) {
+
+        diffLines[nbKept] = diffLine;
+        ++nbKept;
+
+      }
+
+    }
+
+    nb = nbKept;
+
+    // Print the header of the diff of the file
+    fprintf(
+      stream,
+      "--- a/%s\n+++ b/%s\n",
+      that->filePath,
+      that->filePath);
+
+    // Loop on the hunks, made of the changes separated by at most
+    // twice the number of lines of context, and the lines of context
+    // around them
+    unsigned int nbOrig = 0;
+    unsigned int nbFixed = 0;
+    unsigned int iLine = 0;
+    unsigned int iChange = 0;
+    do {
+
+      // Search the next change
+      while (
+        iChange < nb &&
+        CBoDiffLineIsChange(
+          diffLines + iChange,
+          iEndOrig,
+          iEndFixed) == false) {
+
+        ++iChange;
+
+      }
+
+      // If there is a change
+      if (iChange < nb) {
+
+        // Get the first line of the hunk
+        unsigned int iStart = iLine;
+        if (iChange > iLine + CBO_DIFF_NB_CONTEXT) {
+
+          iStart = iChange - CBO_DIFF_NB_CONTEXT;
+
+        }
+
+        // Search the last change of the hunk
+        unsigned int iEnd = iChange + 1;
+        unsigned int iNext = iEnd;
+        while (
+          iNext < nb &&
+          iNext <= iEnd + 2 * CBO_DIFF_NB_CONTEXT) {
+
+          if (
+            CBoDiffLineIsChange(
+              diffLines + iNext,
+              iEndOrig,
+              iEndFixed) == true) {
+
+            iEnd = iNext + 1;
+
+          }
+
+          ++iNext;
+
+        }
+
+        // Get the line after the hunk
+        iEnd += CBO_DIFF_NB_CONTEXT;
+        if (iEnd > nb) {
+
+          iEnd = nb;
+
+        }
+
+        // Count the lines before the hunk
+        while (iLine < iStart) {
+
+          nbOrig += (diffLines[iLine].iOrig > 0 ? 1 : 0);
+          nbFixed += (diffLines[iLine].iFixed > 0 ? 1 : 0);
+          ++iLine;
+
+        }
+
+        // Print the hunk
+        CBoPrintDiffHunk(
+          diffLines + iStart,
+          iEnd - iStart,
+          nbOrig,
+          nbFixed,
+          iEndOrig,
+          iEndFixed,
+          stream);
+
+        // Count the lines of the hunk
+        while (iLine < iEnd) {
+
+          nbOrig += (diffLines[iLine].iOrig > 0 ? 1 : 0);
+          nbFixed += (diffLines[iLine].iFixed > 0 ? 1 : 0);
+          ++iLine;
+
+        }
+
+        iChange = iEnd;
+
+      }
+
+    } while (iChange < nb);
+
+    // Free memory
+    free(diffLines);
+
+  }
+
+}
+
+// Check if the line 'that' of a diff is a change, the original and
+// fixed files end without newline after their lines 'iEndOrig' and
+// 'iEndFixed' if they are not 0
+// Return true if it's a change, false if it's a line of context
+bool CBoDiffLineIsChange(
+  const CBoDiffLine* const that,
+        const unsigned int iEndOrig,
+        const unsigned int iEndFixed) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // A line of context is in both files, and has a newline in both
+  // files or in none
+  bool isChange = (
+    that->iOrig == 0 ||
+    that->iFixed == 0 ||
+    (that->iOrig == iEndOrig) != (that->iFixed == iEndFixed));
+
+  // Return the flag
+  return isChange;
+
+}
+
+// Print on the stream 'stream' the hunk of the 'nb' lines 'diffLines'
+// of a diff, whose first line is preceded by 'nbOrig' lines in the
+// original file and 'nbFixed' lines in the fixed file, the original and
+// fixed files end without newline after their lines 'iEndOrig' and
+// 'iEndFixed' if they are not 0
+void CBoPrintDiffHunk(
+  const CBoDiffLine* const diffLines,
+        const unsigned int nb,
+        const unsigned int nbOrig,
+        const unsigned int nbFixed,
+        const unsigned int iEndOrig,
+        const unsigned int iEndFixed,
+               FILE* const stream) {
+
+#if BUILDMODE == 0
+  if (diffLines == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'diffLines' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (stream == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'stream' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Count the lines of the hunk in the original and fixed files
+  unsigned int nbHunkOrig = 0;
+  unsigned int nbHunkFixed = 0;
+  for (
+    unsigned int iLine = 0;
+    iLine < nb;
+    ++iLine) {
+
+    nbHunkOrig += (diffLines[iLine].iOrig > 0 ? 1 : 0);
+    nbHunkFixed += (diffLines[iLine].iFixed > 0 ? 1 : 0);
+
+  }
+
+  // Print the range of the hunk, which starts after the lines before
+  // it, or at the line before it if it's empty
+  fprintf(
+    stream,
+    "@@ -%u,%u +%u,%u @@\n",
+    nbOrig + (nbHunkOrig > 0 ? 1 : 0),
+    nbHunkOrig,
+    nbFixed + (nbHunkFixed > 0 ? 1 : 0),
+    nbHunkFixed);
+
+  // Loop on the lines of the hunk
+  for (
+    unsigned int iLine = 0;
+    iLine < nb;
+    ++iLine) {
+
+    // Get the line and check if it has no newline in the files
+    const CBoDiffLine* diffLine = diffLines + iLine;
+    bool isNoEolOrig = (
+      diffLine->iOrig > 0 &&
+      diffLine->iOrig == iEndOrig);
+    bool isNoEolFixed = (
+      diffLine->iFixed > 0 &&
+      diffLine->iFixed == iEndFixed);
+
+    // If it's a line of context, print it once
+    if (
+      CBoDiffLineIsChange(
+        diffLine,
+        iEndOrig,
+        iEndFixed) == false) {
+
+      fprintf(
+        stream,
+        " %s\n%s",
+        diffLine->str,
+        (isNoEolOrig == true ? "\\ No newline at end of file\n" : ""));
+
+    // Else, print it as removed and added in the files it belongs to
+    } else {
+
+      if (diffLine->iOrig > 0) {
+
+        fprintf(
+          stream,
+          "-%s\n%s",
+          diffLine->str,
+          (isNoEolOrig == true ? "\\ No newline at end of file\n" : ""));
+
+      }
+
+      if (diffLine->iFixed > 0) {
+
+        fprintf(
+          stream,
+          "+%s\n%s",
+          diffLine->str,
+          (isNoEolFixed == true ? "\\ No newline at end of file\n" : ""));
+
+      }
+
+    }
+
+  }
+
+}
+
+// Replace the file of the CBoFile 'that' with its lines, through a new
+// file renamed as the file once completely written
+// Return true if the file could be saved, else false
+bool CBoFileSave(const CBoFile* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Get the mode of the file, given to the new file
+  struct stat status;
+  bool isSaved =
+    (stat(
+      that->filePath,
+      &status) == 0);
+
+  // Create the new file with a unique name next to the file, so it can
+  // be renamed as the file
+  char* newPath =
+    PBErrMalloc(
+      that->err,
+      strlen(that->filePath) + 8);
+  sprintf(
+    newPath,
+    "%s.XXXXXX",
+    that->filePath);
+  int fd = -1;
+  if (isSaved == true) {
+
+    fd = mkstemp(newPath);
+    isSaved = (fd != -1);
+
+  }
+
+  // If the new file could be created
+  if (isSaved == true) {
+
+    // Loop on the lines, written by batches of segments pointing
+    // directly to the content of the lines and their separators
+    struct iovec segments[CBO_FIX_NB_SEGMENT];
+    unsigned int nbSegment = 0;
+    unsigned int nbLine = GSetNbElem(&(that->lines));
+    GSetIterForward iter =
+      GSetIterForwardCreateStatic(&(that->lines));
+    for (
+      unsigned int iLine = 0;
+      iLine < nbLine &&
+      isSaved == true;
+      ++iLine) {
+
+      // Add the separator with the previous line and the line
+      CBoLine* line = GSetIterGet(&iter);
+      if (iLine > 0) {
+
+        segments[nbSegment].iov_base = (char*)"\n";
+        segments[nbSegment].iov_len = 1;
+        ++nbSegment;
+
+      }
+
+      segments[nbSegment].iov_base = line->str;
+      segments[nbSegment].iov_len = strlen(line->str);
+      ++nbSegment;
+
+      // If the batch is full or it's the last line, write the segments
+      if (
+        nbSegment >= CBO_FIX_NB_SEGMENT - 1 ||
+        iLine == nbLine - 1) {
+
+        isSaved =
+          CBoWriteSegments(
+            fd,
+            segments,
+            nbSegment);
+        nbSegment = 0;
+
+      }
+
+      GSetIterStep(&iter);
+
+    }
+
+    // Give the mode of the file to the new file, close it and replace
+    // the file with it
+    isSaved &=
+      (fchmod(
+        fd,
+        status.st_mode & 07777) == 0);
+    isSaved &= (close(fd) == 0);
+    if (isSaved == true) {
+
+      isSaved =
+        (rename(
+          newPath,
+          that->filePath) == 0);
+
+    }
+
+    // If the file couldn't be saved, remove the new file
+    if (isSaved == false) {
+
+      unlink(newPath);
+
+    }
+
+  }
+
+  free(newPath);
+
+  // Return the flag
+  return isSaved;
+
+}
+
+// Write the 'nb' segments 'segments' in the file 'fd', the segments are
+// updated as they are written
+// Return true if they could be written, else false
+bool CBoWriteSegments(
+      const int fd,
+  struct iovec* segments,
+   unsigned int nb) {
+
+#if BUILDMODE == 0
+  if (segments == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'segments' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the success
+  bool isWritten = true;
+
+  // Loop until all the segments are written, writev may write only
+  // a part of them
+  while (
+    nb > 0 &&
+    isWritten == true) {
+
+    // Write the segments
+    ssize_t nbByte =
+      writev(
+        fd,
+        segments,
+        nb);
+    isWritten = (nbByte >= 0);
+
+    // Skip the segments completely written, and the written part of
+    // the next one
+    size_t nbByteLeft = (isWritten == true ? (size_t)nbByte : 0);
+    while (
+      nb > 0 &&
+      isWritten == true &&
+      nbByteLeft >= segments->iov_len) {
+
+      nbByteLeft -= segments->iov_len;
+      ++segments;
+      --nb;
+
+    }
+
+    if (nb > 0) {
+
+      segments->iov_base = (char*)(segments->iov_base) + nbByteLeft;
+      segments->iov_len -= nbByteLeft;
+
+    }
+
+  }
+
+  // Return the flag
+  return isWritten;
+
+}
+
+// Calculate the mask of the line local rules broken by each line of
+// the CBoFile 'that', using the memoization table of the CBo 'cbo'
+void CBoFileUpdateLocalErrors(
+  CBoFile* const that,
+      CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Loop on the lines
+  unsigned int nbLine = GSetNbElem(&(that->lines));
+  for (
+    unsigned int iLine = 0;
+    iLine < nbLine;
+    ++iLine) {
+
+    // Get the mask of the rules suppressed on the line
+    CBoLine* line = that->lineArr[iLine];
+    unsigned int suppressed =
+      CBoFileGetSuppressedRules(
+        that,
+        iLine);
+
+    // If all the rules are suppressed, the line is not evaluated
+    if (suppressed == (1u << CBoRuleId_nb) - 1) {
 
-          fprintf(
-            that->stream,
-            "The path [%s] is incorrect\n",
-            argv[iArg]);
-          return false;
+      line->localErrors = 0;
 
-        }
+    // Else, get the mask of the line from the memoization table,
+    // without the suppressed rules
+    } else {
 
-      }
+      line->localErrors =
+        CBoGetLineLocalErrors(
+          cbo,
+          line) & ~suppressed;
 
     }
 
   }
 
-  // Return the successfull code
-  return true;
-
 }
 
-// Function to get the number of file with error in the CBo 'that'
-unsigned int CBoGetNbFilesWithError(const CBo* const that) {
+// Check the line 'that' against the LineLength rule
+// Return true if there was no problem, else false
+bool CBoLineCheckLineLength(const CBoLine* const that) {
 
 #if BUILDMODE == 0
   if (that == NULL) {
@@ -550,12 +14579,14 @@ unsigned int CBoGetNbFilesWithError(const CBo* const that) {
 
 #endif
 
-  return GSetNbElem(&(that->filesWithError));
+  // Return true if the length is not too long
+  return (CBoLineGetLength(that) <= CBOLINE_MAX_LENGTH);
 
 }
 
-// Function to get the total number of errors in the CBo 'that'
-unsigned int CBoGetNbErrors(const CBo* const that) {
+// Check the line 'that' against the TrailingSpace rule
+// Return true if there was no problem, else false
+bool CBoLineCheckTrailingSpace(const CBoLine* const that) {
 
 #if BUILDMODE == 0
   if (that == NULL) {
@@ -570,34 +14601,20 @@ unsigned int CBoGetNbErrors(const CBo* const that) {
 
 #endif
 
-  // Declare a variable to memorize the number of errors
-  unsigned int nb = 0;
-
-  // If there is files
-  if (CBoGetNbFiles(that) > 0) {
-
-    // Loop on files
-    GSetIterForward iter = GSetIterForwardCreateStatic(&(that->files));
-    do {
-
-      // Get the file
-      CBoFile* file = GSetIterGet(&iter);
-
-      // Add the number of errors on this file
-      nb += CBoFileGetNbError(file);
-
-    } while(GSetIterStep(&iter));
-
-  }
+  // Get the length of the line
+  unsigned int length = CBoLineGetLength(that);
 
-  // Return the number of errors
-  return nb;
+  // Return false if the last char of the line is a space or a tab
+  return !(
+    length > 0 &&
+    (that->str[length - 1] == ' ' ||
+    that->str[length - 1] == '\t'));
 
 }
 
-// Check the files of the CBo 'that'
+// Check the line 'that' against the TabIndent rule
 // Return true if there was no problem, else false
-bool CBoCheckAllFiles(CBo* const that) {
+bool CBoLineCheckTabIndent(const CBoLine* const that) {
 
 #if BUILDMODE == 0
   if (that == NULL) {
@@ -612,329 +14629,191 @@ bool CBoCheckAllFiles(CBo* const that) {
 
 #endif
 
-  // Declare a variable to memorize if all the file were loaded
-  bool allLoaded = true;
-
-  // Declare a variable to memorize if all the file were correct
-  bool allCorrect = true;
+  // Get the position of the head of the line
+  unsigned int posHead = CBoLineGetPosHead(that);
 
-  // Reset the set of files with error
-  GSetFlush(&(that->filesWithError));
+  // Search for tab in the indentation
+  for (
+    unsigned int iChar = 0;
+    iChar < posHead;
+    ++iChar) {
 
-  // Declare a variable to memorize the current stream
-  FILE* stream = that->stream;
+    if (that->str[iChar] == '\t') {
 
-  // If we display only the list of files with errors
-  if (that->flagListFileError == true) {
+      return false;
 
-    // Set the output stream to null
-    that->stream =
-      fopen(
-        "/dev/null",
-        "w");
+    }
 
   }
 
-  // If there are files to check
-  if (CBoGetNbFiles(that) > 0) {
-
-    // Create a progress bar
-    ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
-    // Loop on the files
-    GSetIterForward iterFilePath =
-      GSetIterForwardCreateStatic(&(that->filePaths));
-    int iFilePath = 0;
-    do {
-
-      // Update and display the progress bar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iFilePath / (float)CBoGetNbFiles(that));
-      fprintf(
-        that->stream,
-        "Loading %d files... %s\r",
-        CBoGetNbFiles(that),
-        ProgBarTxtGet(&progBar));
-      fflush(that->stream);
+  // If we reach here there was no tab in the indentation
+  return true;
 
-      // Get the file path
-      const char* filePath = GSetIterGet(&iterFilePath);
+}
 
-      // Load the file
-      CBoFile* file = CBoFileCreate(filePath);
+// Check the line 'that' against the CharBeforeDot rule
+// Return true if there was no problem, else false
+bool CBoLineCheckCharBeforeDot(const CBoLine* const that) {
 
-      // If we could load the file
-      if (file != NULL) {
+#if BUILDMODE == 0
+  if (that == NULL) {
 
-        // Add the file to the list of files
-        GSetAppend(
-          &(that->files),
-          file);
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
 
-      // Else, we couldn't load the file
-      } else {
+  }
 
-        // Display a message
-        fprintf(
-          stream,
-          "\nFailed to load [%s]\n",
-          filePath);
+#endif
 
-        // Update the flag
-        allLoaded = false;
+  // If the line is a comment there is nothing to check
+  if (CBoLineIsComment(that) == true) {
 
-      }
+    return true;
 
-      ++iFilePath;
+  }
 
-    } while (GSetIterStep(&iterFilePath) == true);
+  // Get the position of the head of the line
+  unsigned int posHead = CBoLineGetPosHead(that);
 
-    // Update and display the progress bar
-    ProgBarTxtSet(
-      &progBar,
-      (float)iFilePath / (float)CBoGetNbFiles(that));
-    fprintf(
-      that->stream,
-      "Loaded %d files     %s\n",
-      CBoGetNbFiles(that),
-      ProgBarTxtGet(&progBar));
-    fflush(that->stream);
+  // Get the length of the line
+  unsigned int length = CBoLineGetLength(that);
 
-    // Loop on the loaded files
-    GSetIterForward iterFile =
-      GSetIterForwardCreateStatic(&(that->files));
-    do {
+  // Shortcut to the content of the line
+  const char* str = that->str;
 
-      // Get the file
-      CBoFile* file = GSetIterGet(&iterFile);
+  // Declare two variables to manage strings
+  bool flagQuote = false;
+  bool flagDoubleQuote = false;
 
-      // Check the file
-      bool correct =
-        CBoFileCheck(
-          file,
-          that);
+  // Loop on the char in the line
+  for (
+    unsigned int iChar = 0;
+    iChar < length;
+    ++iChar) {
 
-      // If the file has error(s)
-      if (correct == false) {
+    if (str[iChar] == '\'') {
 
-        // If we display only the list of files with errors
-        if (that->flagListFileError == true) {
+      if (flagDoubleQuote == false) {
 
-          // Print the file path
-          fprintf(
-            stream,
-            "%s\n",
-            file->filePath);
+        flagQuote = !flagQuote;
 
-        } else {
+      }
 
-          // Display the errors of the file
-          CBoFilePrintErrors(
-            file,
-            that->stream);
+    } else if (str[iChar] == '"') {
 
-        }
+      if (flagQuote == false) {
 
-        // Add it to the list of files with errors
-        GSetAppend(
-          &(that->filesWithError),
-          file);
+        flagDoubleQuote = !flagDoubleQuote;
 
       }
 
-      // Update the global flag
-      allCorrect &= correct;
-
-    } while (GSetIterStep(&iterFile) == true);
+    }
 
-  }
+    // If we are not in a string
+    if (flagQuote == false && flagDoubleQuote == false) {
 
-  // If we display only the list of files with errors
-  if (that->flagListFileError == true) {
+      // If the dot is not at the head of the line and
+      // the char before the '.' is invalid
+      if (
+        str[iChar] == '.' &&
+        !(iChar > 0 && str[iChar - 1] == '.') &&
+        str[iChar + 1] != '.' &&
+        (iChar == 0 ||
+        (iChar != posHead &&
+        !(str[iChar - 1] >= 'a' && str[iChar - 1] <= 'z') &&
+        !(str[iChar - 1] >= 'A' && str[iChar - 1] <= 'Z') &&
+        !(str[iChar - 1] >= '0' && str[iChar - 1] <= '9') &&
+        str[iChar - 1] != ' ' &&
+        str[iChar - 1] != ']' &&
+        str[iChar - 1] != ')'))) {
+
+        return false;
 
-    // Close the temporary null stream
-    fclose(that->stream);
+      }
 
-    // Reset the output stream
-    that->stream = stream;
+    }
 
   }
 
-  // Return the success flag
-  return allLoaded & allCorrect;
+  // If we reach here there was no problem
+  return true;
 
 }
 
-// Function to create a new CBoFile from its file path,
-// Return a pointer to the new CBoFile
-CBoFile* CBoFileCreate(const char* const filePath) {
+// Check the line 'that' against the SpaceAroundComma rule
+// Return true if there was no problem, else false
+bool CBoLineCheckSpaceAroundComma(const CBoLine* const that) {
 
 #if BUILDMODE == 0
-  if (filePath == NULL) {
+  if (that == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'filePath' is null");
+      "'that' is null");
     PBErrCatch(CBoErr);
 
   }
 
 #endif
 
-  // Create the new CBoFile
-  CBoFile* that = (CBoFile*)malloc(sizeof(CBoFile));
-
-  // Initialise properties
-  that->filePath = filePath;
-  that->type = CBoFileGetTypeFromPath(filePath);
-  that->lines = GSetCreateStatic();
-  that->errors = GSetCreateStatic();
-
-  // Declare a variable to manage error while reading the lines
-  int ret = !EOF;
-
-  // If it's a known type
-  if (that->type != CBoFileType_unknown) {
-
-    // Open the file
-    FILE* fp =
-      fopen(
-        filePath,
-        "r");
+  // If the line is a comment there is nothing to check
+  if (CBoLineIsComment(that) == true) {
 
-    // Declare a buffer to read one line
-    char buffer[1000];
+    return true;
 
-    // Loop on the lines of the file
-    while (!feof(fp) && ret != EOF) {
+  }
 
-      // Create a pointer on the char of the line
-      char* ptr = buffer;
-      *ptr = '\0';
+  // Get the length of the line
+  unsigned int length = CBoLineGetLength(that);
 
-      // Loop on the char of the line until the end of the line or
-      // an error occured or we reach the end of the file or the end
-      // of the buffer
-      while (
-        *ptr != '\n' &&
-        !feof(fp) &&
-        ret != EOF &&
-        ptr < buffer + 999) {
+  // Declare two flags to memorize the strings in the code
+  bool flagQuote = false;
+  bool flagDoubleQuote = false;
 
-        // Read one char
-        ret =
-          fscanf(
-            fp,
-            "%c",
-            ptr);
+  // Loop on the char of the line
+  for (
+    unsigned int iChar = 0;
+    iChar < length;
+    ++iChar) {
 
-        // If we could read the character and it wasn't the end
-        // of the line
-        if (ret != EOF && *ptr != '\n') {
+    if (that->str[iChar] == '\'') {
 
-          // Move to the next char
-          ++ptr;
+      if (flagDoubleQuote == false) {
 
-        }
+        flagQuote = !flagQuote;
 
       }
 
-      // If there was an error
-      if ((!feof(fp) && ret == EOF) || ptr >= buffer + 999) {
-
-        ret = EOF;
-
-      // Else there was no error while reading the line
-      } else {
-
-        // Add the null character to the end of the string
-        *ptr = '\0';
-
-        // Create the CBoLine
-        CBoLine* line = CBoLineCreate(buffer);
-
-        // If we couldn't create the CBoLine
-        if (line != NULL) {
-
-          GSetAppend(
-            &(that->lines),
-            line);
-
-        } else {
+    } else if (that->str[iChar] == '"') {
 
-          ret = EOF;
+      if (flagQuote == false) {
 
-        }
+        flagDoubleQuote = !flagDoubleQuote;
 
       }
 
     }
 
-    // If there has been an error
-    if (!feof(fp) && ret == EOF) {
-
-      CBoFileFree(&that);
-
-    }
-
-    // Close the file
-    fclose(fp);
-
-  }
-
-  // Calculate the proper indentation level of each line of the file
-  CBoFileUpdateIndentLvlLines(that);
-
-  // Return the new CBoFile
-  return that;
-
-}
-
-// Function to detect the type of a file from its path
-// Return a CBoFileType
-CBoFileType CBoFileGetTypeFromPath(const char* const filePath) {
-
-#if BUILDMODE == 0
-  if (filePath == NULL) {
-
-    CBoErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      CBoErr->_msg,
-      "'filePath' is null");
-    PBErrCatch(CBoErr);
-
-  }
-
-#endif
-
-  // Get the position of the last '.'
-  char* ptr =
-    strrchr(
-      filePath,
-      '.');
-
-  // If we could find the last '.'
-  if (ptr != NULL) {
-
-    unsigned int retStrCmp =
-      strcmp(
-        ptr,
-        ".c");
-    if (retStrCmp == 0) {
-
-      return CBoFileType_C_body;
-
-    } else {
+    // If we are not in a string and the char is a comma
+    if (
+      flagQuote == false &&
+      flagDoubleQuote == false &&
+      that->str[iChar] == ',') {
 
-      retStrCmp =
-        strcmp(
-          ptr,
-          ".h");
-      if (retStrCmp == 0) {
+      // If the previous char is a space, or the next one is not a
+      // space and the comma is not at the end of the line
+      if (
+        iChar == 0 ||
+        that->str[iChar - 1] == ' ' ||
+        that->str[iChar - 1] == '\t' ||
+        (that->str[iChar + 1] != ' ' &&
+        iChar != length - 1)) {
 
-        return CBoFileType_C_header;
+        return false;
 
       }
 
@@ -942,13 +14821,14 @@ CBoFileType CBoFileGetTypeFromPath(const char* const filePath) {
 
   }
 
-  // By default return 'unknown'
-  return CBoFileType_unknown;
+  // If we reach here there was no problem
+  return true;
 
 }
 
-// Return the number of errors in the CBoFile 'that'
-unsigned int CBoFileGetNbError(const CBoFile* const that) {
+// Check the line 'that' against the SpaceAroundSemicolon rule
+// Return true if there was no problem, else false
+bool CBoLineCheckSpaceAroundSemicolon(const CBoLine* const that) {
 
 #if BUILDMODE == 0
   if (that == NULL) {
@@ -963,41 +14843,61 @@ unsigned int CBoFileGetNbError(const CBoFile* const that) {
 
 #endif
 
-  // Return the number of error
-  return GSetNbElem(&(that->errors));
+  // Get the length of the line
+  unsigned int length = CBoLineGetLength(that);
 
-}
+  // Declare two flags to memorize the strings in the code
+  bool flagQuote = false;
+  bool flagDoubleQuote = false;
 
-// Function to free the memory used by the CBoFile 'that'
-void CBoFileFree(CBoFile** const that) {
+  // Loop on the char of the line
+  for (
+    unsigned int iChar = 0;
+    iChar < length;
+    ++iChar) {
 
-  if (that == NULL || *that == NULL) return;
+    if (that->str[iChar] == '\'') {
 
-  // Free the lines
-  while (GSetNbElem(&((*that)->lines)) > 0) {
+      if (flagDoubleQuote == false) {
 
-    CBoLine* line = GSetPop(&((*that)->lines));
-    CBoLineFree(&line);
+        flagQuote = !flagQuote;
 
-  }
+      }
 
-  // Free the errors
-  while (GSetNbElem(&((*that)->errors)) > 0) {
+    } else if (that->str[iChar] == '"') {
 
-    CBoError* error = GSetPop(&((*that)->errors));
-    CBoErrorFree(&error);
+      if (flagQuote == false) {
+
+        flagDoubleQuote = !flagDoubleQuote;
+
+      }
+
+    }
+
+    // If we are not in a string, and the char is a semicolon and the
+    // previous one is a space
+    if (
+      flagQuote == false &&
+      flagDoubleQuote == false &&
+      that->str[iChar] == ';' &&
+      (iChar == 0 ||
+      that->str[iChar - 1] == ' ' ||
+      that->str[iChar - 1] == '\t')) {
+
+      return false;
+
+    }
 
   }
 
-  // Free the CBoFile
-  free(*that);
-  *that = NULL;
+  // If we reach here there was no problem
+  return true;
 
 }
 
-// Calculate the proper indentation level of each line of the
-// CBoFile 'that'
-void CBoFileUpdateIndentLvlLines(CBoFile* const that) {
+// Check the line 'that' against the SpaceBeforeOpenCurlyBrace rule
+// Return true if there was no problem, else false
+bool CBoLineCheckSpaceBeforeOpenCurlyBrace(const CBoLine* const that) {
 
 #if BUILDMODE == 0
   if (that == NULL) {
@@ -1012,280 +14912,178 @@ void CBoFileUpdateIndentLvlLines(CBoFile* const that) {
 
 #endif
 
-  // Declare a variable to memorize the current indent level
-  unsigned int indent = 0;
-
-  // Declare a variable to memorise the index of the current line
-  unsigned int iLine = 0;
-
-  // If the file is not empty
-  if (GSetNbElem(&(that->lines)) > 0) {
-
-    // Declare a flag to memorize the multiline lines
-    bool flagMultiline = false;
+  // If the line is a comment there is nothing to check
+  if (CBoLineIsComment(that) == true) {
 
-    // Declare a flag to memorize the line inside parenthesis
-    bool flagInParenthesis = false;
+    return true;
 
-    // Declare flag to detect for (...) and case ...
-    bool flagFor = false;
-    bool flagCase = false;
+  }
 
-    // Loop on the lines of the file
-    GSetIterForward iter = GSetIterForwardCreateStatic(&(that->lines));
-    do {
+  // Get the length of the line
+  unsigned int length = CBoLineGetLength(that);
 
-      // Get the line
-      CBoLine* line = GSetIterGet(&iter);
+  // Declare two variables to manage strings
+  bool flagQuote = false;
+  bool flagDoubleQuote = false;
 
-      // Get the length of the line
-      unsigned int length = CBoLineGetLength(line);
+  // Loop on the char in the line
+  for (
+    unsigned int iChar = 0;
+    iChar < length;
+    ++iChar) {
 
-      // Get the position of the head of the line
-      unsigned int posHead = CBoLineGetPosHead(line);
+    if (that->str[iChar] == '\'') {
 
-      // Check if we are on a for(...)
-      char* ptrFor =
-        strstr(
-          line->str,
-          "for (");
-      if (ptrFor == line->str + posHead) {
+      if (flagDoubleQuote == false) {
 
-        flagFor = true;
+        flagQuote = !flagQuote;
 
       }
 
-      // Check if we are on a case ...: or default:
-      char* ptrCase =
-        strstr(
-          line->str,
-          "case ");
-      char* ptrDefault =
-        strstr(
-          line->str,
-          "default:");
-      if (
-        ptrCase == line->str + posHead ||
-        ptrDefault == line->str + posHead) {
-
-        flagCase = true;
-
-      }
+    } else if (that->str[iChar] == '"') {
 
-      // If the line starts with '}' and is not a precompiler command
-      bool isPrecompilCmd =
-        CBoFileIsLinePrecompilCmd(
-          that,
-          iLine);
-      if (
-        line->str[posHead] == '}' &&
-        isPrecompilCmd == false) {
+      if (flagQuote == false) {
 
-        // Decrement the indent level
-        indent -= CBOLINE_INDENT_SIZE;
+        flagDoubleQuote = !flagDoubleQuote;
 
       }
 
-      // Update the indent level of the line
-      line->indent = indent;
-
-      // If the line is not empty and not a comment and not a precompiler
-      // command
-      if (
-        length > 0 &&
-        CBoLineIsComment(line) == false &&
-        isPrecompilCmd == false) {
-
-        // If the line ends with '{'
-        if (line->str[length - 1] == '{') {
-
-          // If we are not on a line inside parenthesis
-          if (flagInParenthesis == false) {
-
-            // Increment the indent level
-            indent += CBOLINE_INDENT_SIZE;
-
-          }
-
-          // Update the flag
-          flagInParenthesis = false;
-          flagFor = false;
-
-        // If the line ends with '('
-        } else if (line->str[length - 1] == '(') {
-
-          // Increment the indent level
-          indent += CBOLINE_INDENT_SIZE;
+    }
 
-          // Update the flag
-          flagInParenthesis = true;
+    // If we are not in a string, and the char is an opening curly
+    // brace not preceded by another curly brace or space
+    if (
+      flagQuote == false &&
+      flagDoubleQuote == false &&
+      that->str[iChar] == '{' &&
+      iChar > 0 &&
+      that->str[iChar - 1] != ' ' &&
+      that->str[iChar - 1] != '{') {
 
-        // If the line ends with '='
-        } else if (line->str[length - 1] == '=') {
+      return false;
 
-          // Update the multiline flag
-          flagMultiline = true;
+    }
 
-          // Increment the indent level
-          indent += CBOLINE_INDENT_SIZE;
+  }
 
-        // Else if the line ends with ';'
-        } else if (line->str[length - 1] == ';') {
+  // If we reach here there was no problem
+  return true;
 
-          // If we are on a multiline
-          if (flagMultiline == true) {
+}
 
-            // Update the multiline flag
-            flagMultiline = false;
+// Get the mask (1 << CBoRuleId) of the line local rules broken by the
+// line 'that'
+// Return the mask
+unsigned int CBoLineGetLocalErrors(const CBoLine* const that) {
 
-            // Decrement the indent level
-            indent -= CBOLINE_INDENT_SIZE;
+#if BUILDMODE == 0
+  if (that == NULL) {
 
-          }
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
 
-          // If we are inside parenthesis but not in a for (...)
-          if (
-            flagInParenthesis == true &&
-            flagFor == false) {
+  }
 
-            // Update the flag
-            flagInParenthesis = false;
+#endif
 
-            // Decrement the indent level
-            indent -= CBOLINE_INDENT_SIZE;
+  // Declare a variable to memorize the mask
+  unsigned int mask = 0;
 
-          }
+  // Check each line local rule
+  if (CBoLineCheckLineLength(that) == false) {
 
-          // If we are in a case ...
-          if (flagCase == true) {
+    mask |= (1u << CBoRuleId_LineLength);
 
-            // If the line is the break line of the case
-            char* ptrBreak =
-              strstr(
-                line->str,
-                "break;");
-            if (ptrBreak == line->str + posHead) {
+  }
 
-              // Update the flag
-              flagCase = false;
+  if (CBoLineCheckTrailingSpace(that) == false) {
 
-              // Decrement the indent level
-              indent -= CBOLINE_INDENT_SIZE;
+    mask |= (1u << CBoRuleId_TrailingSpace);
 
-            }
+  }
 
-          }
+  if (CBoLineCheckTabIndent(that) == false) {
 
-        // Else if the line ends with ':'
-        } else if (line->str[length - 1] == ':') {
+    mask |= (1u << CBoRuleId_TabIndent);
 
-          // Update the flag
-          flagCase = true;
+  }
 
-          // Decrement the indent level
-          indent += CBOLINE_INDENT_SIZE;
+  if (CBoLineCheckCharBeforeDot(that) == false) {
 
-        }
+    mask |= (1u << CBoRuleId_CharBeforeDot);
 
-      }
+  }
 
-      // Increment the index of the current line
-      ++iLine;
+  if (CBoLineCheckSpaceAroundComma(that) == false) {
 
-    } while (GSetIterStep(&iter));
+    mask |= (1u << CBoRuleId_SpaceAroundComma);
 
   }
 
-}
-
-// Function to add the CBoError 'error' to the CBoFile 'that'
-void CBoFileAddError(
-   CBoFile* const that,
-  CBoError* const error) {
-
-#if BUILDMODE == 0
-  if (that == NULL) {
+  if (CBoLineCheckSpaceAroundSemicolon(that) == false) {
 
-    CBoErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      CBoErr->_msg,
-      "'that' is null");
-    PBErrCatch(CBoErr);
+    mask |= (1u << CBoRuleId_SpaceAroundSemicolon);
 
   }
 
-  if (error == NULL) {
+  if (CBoLineCheckSpaceBeforeOpenCurlyBrace(that) == false) {
 
-    CBoErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      CBoErr->_msg,
-      "'error' is null");
-    PBErrCatch(CBoErr);
+    mask |= (1u << CBoRuleId_SpaceBeforeOpenCurlyBrace);
 
   }
 
-#endif
-
-  // Add the error sorted on the line index
-  GSetAddSort(
-    &(that->errors),
-    error,
-    error->iLine);
+  // Return the mask
+  return mask;
 
 }
 
-// Display the errors of the CBoFile 'that' on the FILE 'stream'
-void CBoFilePrintErrors(
-  CBoFile* const that,
-           FILE* stream) {
+// Calculate the 64 bits FNV-1a hash of the 'length' first bytes of
+// 'str'
+// Return the hash
+uint64_t CBoHashFNV1a(
+   const char* const str,
+  const unsigned int length) {
 
 #if BUILDMODE == 0
-  if (that == NULL) {
-
-    CBoErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      CBoErr->_msg,
-      "'that' is null");
-    PBErrCatch(CBoErr);
-
-  }
-
-  if (stream == NULL) {
+  if (str == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'stream' is null");
+      "'str' is null");
     PBErrCatch(CBoErr);
 
   }
 
 #endif
 
-  // If there are errors
-  if (GSetNbElem(&(that->errors)) > 0) {
-
-    // Loop on errors
-    GSetIterForward iter = GSetIterForwardCreateStatic(&(that->errors));
-    do {
-
-      // Get the error
-      CBoError* error = GSetIterGet(&iter);
+  // Declare the hash, initialised with the offset basis
+  uint64_t hash = CBO_FNV1A_OFFSET;
 
-      // Print the error
-      CBoErrorPrint(
-        error,
-        stream);
+  // Loop on the bytes
+  for (
+    unsigned int iByte = 0;
+    iByte < length;
+    ++iByte) {
 
-    } while(GSetIterStep(&iter));
+    hash ^= (unsigned char)(str[iByte]);
+    hash *= CBO_FNV1A_PRIME;
 
   }
 
+  // Return the hash
+  return hash;
+
 }
 
-// Function to create a new CBoLine from its content,
-// Return a pointer to the new CBoLine
-CBoLine* CBoLineCreate(const char* const str) {
+// Calculate the 32 bits djb2 hash of the 'length' first bytes of 'str'
+// Return the hash
+uint32_t CBoHashDJB2(
+   const char* const str,
+  const unsigned int length) {
 
 #if BUILDMODE == 0
   if (str == NULL) {
@@ -1300,62 +15098,64 @@ CBoLine* CBoLineCreate(const char* const str) {
 
 #endif
 
-  // Declare the new CBoLine
-  CBoLine* that = (CBoLine*)malloc(sizeof(CBoLine));
-
-  if (that != NULL) {
-
-    // Copy the content
-    that->str = strdup(str);
-
-    // If we couldn't copy the content
-    if (that->str == NULL) {
-
-      free(that);
-      that = NULL;
+  // Declare the hash, initialised with the seed of djb2
+  uint32_t hash = CBO_DJB2_SEED;
 
-    }
+  // Loop on the bytes
+  for (
+    unsigned int iByte = 0;
+    iByte < length;
+    ++iByte) {
 
-    // Init the indent level
-    that->indent = 0;
+    hash = hash * 33 + (unsigned char)(str[iByte]);
 
   }
 
-  // Return the CBoLine
-  return that;
+  // Return the hash
+  return hash;
 
 }
 
-// Function to free the memory used by the CBoLine 'that'
-void CBoLineFree(CBoLine** const that) {
-
-  if (that == NULL || *that == NULL) return;
+// Mix the bits of 'key' with the finalizer of splitmix64, each bit of
+// the result depends on all the bits of 'key'
+// Return the mixed key
+uint64_t CBoHashMix64(const uint64_t key) {
 
-  // Free the line content
-  free((*that)->str);
+  // Spread the high bits on the low ones and the low bits on the high
+  // ones, twice
+  uint64_t mixed = key;
+  mixed = (mixed ^ (mixed >> 30)) * CBO_MIX64_MUL1;
+  mixed = (mixed ^ (mixed >> 27)) * CBO_MIX64_MUL2;
+  mixed ^= mixed >> 31;
 
-  // Free the CBoLine
-  free(*that);
-  *that = NULL;
+  // Return the mixed key
+  return mixed;
 
 }
 
-// Function to create a new CBoError from its file, line, index of line
-// and type
-// Return a pointer to the new CBoError
-CBoError* CBoErrorCreate(
-      CBoFile* const file,
-      CBoLine* const line,
-  const unsigned int iLine,
-  const CBoErrorType type) {
+// Get the mask of the line local rules broken by the line 'line' from
+// the memoization table of the CBo 'that', or calculate it and
+// memorize it if it's not in the table
+// The table is shared between threads, each entry is a pair of words
+// (FNV-1a hash of the line, djb2 hash of the line << 32 | mask | ready
+// bit), the first hash is set once with a compare and swap, then the
+// value is published, a value of 0 means the entry is not ready yet
+// and the caller calculates the mask by itself. The second hash,
+// independent from the first one, is checked before reusing the mask
+// of an entry so a collision of the first one doesn't give the mask of
+// another line
+// Return the mask
+unsigned int CBoGetLineLocalErrors(
+            CBo* const that,
+  const CBoLine* const line) {
 
 #if BUILDMODE == 0
-  if (file == NULL) {
+  if (that == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'file' is null");
+      "'that' is null");
     PBErrCatch(CBoErr);
 
   }
@@ -1372,258 +15172,206 @@ CBoError* CBoErrorCreate(
 
 #endif
 
-  // Declare the new CBoError
-  CBoError* that = (CBoError*)malloc(sizeof(CBoError));
-
-  if (that != NULL) {
+  // Get the hashes of the line, 0 is reserved for empty entries
+  unsigned int length = CBoLineGetLength(line);
+  uint64_t hash =
+    CBoHashFNV1a(
+      line->str,
+      length);
+  if (hash == 0) {
 
-    // Init properties
-    that->file = file;
-    that->iLine = iLine;
-    that->line = line;
-    that->type = type;
+    hash = 1;
 
   }
 
-  // Return the CBoLine
-  return that;
+  uint64_t check =
+    CBoHashDJB2(
+      line->str,
+      length);
 
-}
+  // Loop on the entries from the one of the hash, up to a maximum
+  // number of probes
+  for (
+    unsigned int iProbe = 0;
+    iProbe < CBO_LINE_MEMO_NB_PROBE;
+    ++iProbe) {
+
+    // Get the entry
+    unsigned int iEntry = (hash + iProbe) & (CBO_LINE_MEMO_SIZE - 1);
+    uint64_t* entry = that->lineMemo + 2 * iEntry;
+
+    // Try to claim the entry if it's empty
+    uint64_t key = 0;
+    bool claimed =
+      __atomic_compare_exchange_n(
+        entry,
+        &key,
+        hash,
+        false,
+        __ATOMIC_ACQ_REL,
+        __ATOMIC_ACQUIRE);
+
+    // If the entry has been claimed, calculate and publish the mask
+    if (claimed == true) {
+
+      unsigned int mask = CBoLineGetLocalErrors(line);
+      uint64_t value = (check << 32) | CBO_LINE_MEMO_READY | mask;
+      __atomic_store_n(
+        entry + 1,
+        value,
+        __ATOMIC_RELEASE);
+      return mask;
+
+    // Else, if the entry is the one of the line
+    } else if (key == hash) {
+
+      // If the value is ready and is the one of a line with the same
+      // second hash
+      uint64_t value =
+        __atomic_load_n(
+          entry + 1,
+          __ATOMIC_ACQUIRE);
+      if (
+        (value & CBO_LINE_MEMO_READY) != 0 &&
+        (value >> 32) == check) {
 
-// Function to free the memory used by the CBoError 'that'
-void CBoErrorFree(CBoError** const that) {
+        // Return the memorized mask
+        return (unsigned int)(value & CBO_LINE_MEMO_MASK);
 
-  if (that == NULL || *that == NULL) return;
+      }
 
-  // Free the CBoError
-  free(*that);
-  *that = NULL;
+      // Else, the entry is not ready yet or it's a collision, stop
+      // searching
+      iProbe = CBO_LINE_MEMO_NB_PROBE;
+
+    }
+
+  }
+
+  // If we reach here the line couldn't be found nor added in the
+  // table, calculate its mask
+  return CBoLineGetLocalErrors(line);
 
 }
 
-// Function to display the CBoError 'that' on the stream 'stream'
-void CBoErrorPrint(
-  const CBoError* const that,
-            FILE* const stream) {
+// Calculate the order of check of the rules described by 'rules' such
+// as each rule comes after its prerequisites, keeping the order of
+// 'rules' as much as possible, and memorize it in 'order'
+void CBoRuleGetSchedule(
+  const CBoRule* const rules,
+   unsigned int* const order) {
 
 #if BUILDMODE == 0
-  if (that == NULL) {
+  if (rules == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'that' is null");
+      "'rules' is null");
     PBErrCatch(CBoErr);
 
   }
 
-  if (stream == NULL) {
+  if (order == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'stream' is null");
+      "'order' is null");
     PBErrCatch(CBoErr);
 
   }
 
 #endif
 
-  // Create the coloring pattern
-  char* errMsg =
-    SGRString(SGR_ColorFG(
-      255,
-      0,
-      0,
-      "%s:%u %s."));
-  char* errLine =
-    SGRString(SGR_ColorBG(
-      50,
-      50,
-      50,
-      "%s"));
-
-  // Print the error message
-  fprintf(
-    stream,
-    errMsg,
-    that->file->filePath,
-    that->iLine,
-    cboErrorTypeStr[that->type]);
-  fprintf(
-    stream,
-    "\n");
+  // Declare a variable to memorize the scheduled rules
+  unsigned int scheduled = 0;
 
-  // Print the error line
-  fprintf(
-    stream,
-    errLine,
-    that->line->str);
-  fprintf(
-    stream,
-    "\n");
+  // Loop on the positions in the order
+  for (
+    unsigned int iOrder = 0;
+    iOrder < CBoRuleId_nb;
+    ++iOrder) {
 
-  // Free memory
-  free(errMsg);
-  free(errLine);
+    // Search the first rule not yet scheduled and whose prerequisites
+    // are all scheduled
+    unsigned int iRule = 0;
+    while (
+      iRule < CBoRuleId_nb &&
+      ((scheduled & (1u << iRule)) != 0 ||
+      (rules[iRule].prerequisites & ~scheduled) != 0)) {
+
+      ++iRule;
+
+    }
+
+    // If there is none, the prerequisites are cyclic, in that case
+    // fall back to the first rule not yet scheduled
+    if (iRule == CBoRuleId_nb) {
+
+      iRule = 0;
+      while ((scheduled & (1u << iRule)) != 0) {
+
+        ++iRule;
+
+      }
+
+    }
+
+    // Schedule the rule
+    order[iOrder] = iRule;
+    scheduled |= (1u << iRule);
 
-  // Flush the stream
-  fflush(stream);
+  }
 
 }
 
-// Check the CBoFile 'that' with the CBo 'cbo'
-// Return true if there was no problem, else false
-bool CBoFileCheck(
-  CBoFile* const that,
-      CBo* const cbo) {
+// Display the result of the rule labelled 'label' on the stream of the
+// CBo 'cbo', given its success 'success'. Nothing is formatted if the
+// output of the check is not displayed (null stream)
+void CBoPrintRuleResult(
+   const CBo* const cbo,
+  const char* const label,
+         const bool success) {
 
 #if BUILDMODE == 0
-  if (that == NULL) {
+  if (cbo == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'that' is null");
+      "'cbo' is null");
     PBErrCatch(CBoErr);
 
   }
 
-  if (cbo == NULL) {
+  if (label == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'cbo' is null");
+      "'label' is null");
     PBErrCatch(CBoErr);
 
   }
 
 #endif
 
-  // If the user hasn't requested to display only the list of
-  // file(s) with error(s)
-  if (cbo->flagListFileError == false) {
-
-    // Display an info message
-    char* msg =
-      SGRString(SGR_ColorFG(
-        125,
-        125,
-        255,
-        "=== Check file [%s] as %s ==="));
-    fprintf(
-      cbo->stream,
-      msg,
-      that->filePath,
-      cboFileTypeStr[that->type]);
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
-    free(msg);
-
-  }
-
-  // Declare a variable to memorize the success
-  bool success = true;
-
-  // Check the rules according to the type of file
-  if (
-    that->type == CBoFileType_C_header ||
-    that->type == CBoFileType_C_body) {
-
-    success &=
-      CBoFileCheckLineLength(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckTrailingSpace(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckContinuationMark(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckTabIndent(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckEmptyLineBeforeClosingCurlyBrace(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckEmptyLineAfterOpeningCurlyBrace(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckEmptyLineAfterClosingCurlyBrace(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckSpaceAroundComma(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckSpaceAroundSemicolon(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckSpaceAroundOperator(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckSeveralBlankLines(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckNoCurlyBraceAtHead(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckNoCurlyBraceAtTail(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckCharBeforeDot(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckSpaceBeforeOpenCurlyBrace(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckEmptyLineBeforeComment(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckSeveralArgOnOneLine(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckAlignmentArg(
-        that,
-        cbo);
-    success &=
-      CBoFileCheckEmptyLineBeforeCase(
-        that,
-        cbo);
-
-    // If there is still no problem, check the indentation only
-    if (success == true) {
-
-      success &=
-        CBoFileCheckIndentLevel(
-          that,
-          cbo);
+  // If the output of the check is not displayed, there is nothing to do
+  if (cbo->stream == NULL) {
 
-    }
+    return;
 
   }
 
-  // Return the successfull code
-  return success;
+  // Display the label with the completed progress bar, and OK if the
+  // rule has passed
+  fprintf(
+    cbo->stream,
+    "%s %s%s\n",
+    label,
+    CBO_RULE_RESULT_PROGBAR,
+    (success == true ? " OK" : ""));
 
 }
 
@@ -1659,9 +15407,6 @@ bool CBoFileCheckLineLength(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -1671,24 +15416,12 @@ bool CBoFileCheckLineLength(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckLineLength %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
-      // Get the length of the line
-      unsigned int length = CBoLineGetLength(line);
-
-      // If the length is too long
-      if (length > CBOLINE_MAX_LENGTH) {
+      // If the line breaks the rule
+      unsigned int mask = (1u << CBoRuleId_LineLength);
+      if ((line->localErrors & mask) != 0) {
 
         // Update the success flag
         success = false;
@@ -1710,28 +15443,15 @@ bool CBoFileCheckLineLength(
 
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckLineLength %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckLineLength",
+      success);
 
   }
 
@@ -1773,9 +15493,6 @@ bool CBoFileCheckTrailingSpace(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -1785,27 +15502,12 @@ bool CBoFileCheckTrailingSpace(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckTrailingSpace %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
-      // Get the length of the line
-      unsigned int length = CBoLineGetLength(line);
-
-      // If the last char of the line is a space or a tab
-      if (
-        length > 0 &&
-        (line->str[length - 1] == ' ' ||
-        line->str[length - 1] == '\t')) {
+      // If the line breaks the rule
+      unsigned int mask = (1u << CBoRuleId_TrailingSpace);
+      if ((line->localErrors & mask) != 0) {
 
         // Update the success flag
         success = false;
@@ -1827,28 +15529,15 @@ bool CBoFileCheckTrailingSpace(
 
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckTrailingSpace %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckTrailingSpace",
+      success);
 
   }
 
@@ -1890,9 +15579,6 @@ bool CBoFileCheckContinuationMark(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -1905,25 +15591,21 @@ bool CBoFileCheckContinuationMark(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckContinuationMark %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
       // Get the length of the line
       unsigned int length = CBoLineGetLength(line);
 
-      // If the last char of the line is a continuation mark and there is
-      // a previous line
+      // If the rule is not suppressed on the line, the last char of the
+      // line is a continuation mark and there is a previous line
+      bool isSuppressed =
+        CBoFileIsSuppressed(
+          that,
+          iLine,
+          CBoErrorType_LineContinuationMarksMustBeAligned);
       if (
+        isSuppressed == false &&
         length > 0 &&
         line->str[length - 1] == '\\' &&
         prevLine != NULL) {
@@ -1961,28 +15643,212 @@ bool CBoFileCheckContinuationMark(
       ++iLine;
       prevLine = line;
 
-    } while (GSetIterStep(&iter));
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
+
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckContinuationMark",
+      success);
+
+  }
+
+  // Return the successfull code
+  return success;
+
+}
+
+// Check there is an empty line before closing curly braces of the
+// CBoFile 'that' with the CBo 'cbo'
+// Return true if there was no problem, else false
+bool CBoFileCheckEmptyLineBeforeClosingCurlyBrace(
+  CBoFile* const that,
+      CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the success
+  bool success = true;
+
+  // If the file is not empty
+  if (GSetNbElem(&(that->lines)) > 1) {
+
+    // Shortcuts to the bitsets
+    const uint64_t* blank = that->lineFlags[CBoLineFlag_blank];
+    const uint64_t* comment = that->lineFlags[CBoLineFlag_comment];
+    const uint64_t* continuation =
+      that->lineFlags[CBoLineFlag_continuation];
+    const uint64_t* closeCurlyAtHead =
+      that->lineFlags[CBoLineFlag_closeCurlyAtHead];
+
+    // Declare a variable to memorize the carry of the addition from
+    // one word to the next
+    uint64_t carry = 0;
+
+    // Loop on the words of the bitsets
+    for (
+      unsigned int iWord = 0;
+      iWord < that->nbWord &&
+      CBoFileIsErrorBudgetSpent(that) == false;
+      ++iWord) {
+
+      // The previous non comment line is searched as follow: the non
+      // comment lines which are not empty and not terminated by an
+      // antislash start a run of bits, the other non comment lines stop
+      // it, and the comment lines propagate it. Adding the starts to
+      // the non stop bits propagates a carry along the runs, and the
+      // carries entering each bit give the lines whose previous non
+      // comment line starts a run
+      uint64_t start =
+        ~(comment[iWord] |
+        blank[iWord] |
+        continuation[iWord]);
+      uint64_t noStop = comment[iWord] | start;
+      uint64_t sum = noStop + start;
+      uint64_t carryOut = (sum < noStop);
+      uint64_t sumCarry = sum + carry;
+      carryOut |= (sumCarry < sum);
+      carry = carryOut;
+
+      // A line is in error if it starts with a closing curly brace and
+      // its previous non comment line starts a run
+      uint64_t word =
+        closeCurlyAtHead[iWord] &
+        (sumCarry ^ noStop ^ start);
+
+      // Add the errors of this word to the file
+      bool noError =
+        CBoFileAddErrorsFromWord(
+          that,
+          word,
+          iWord,
+          CBoErrorType_EmptyLineBeforeClosingCurlyBrace);
+      if (noError == false) {
+
+        // Update the success flag
+        success = false;
+
+      }
+
+    }
+
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckEmptyLineBeforeClosingCurlyBrace",
+      success);
+
+  }
+
+  // Return the successfull code
+  return success;
+
+}
+
+// Check there is an empty line after opening curly braces of the
+// CBoFile 'that' with the CBo 'cbo'
+// Return true if there was no problem, else false
+bool CBoFileCheckEmptyLineAfterOpeningCurlyBrace(
+  CBoFile* const that,
+      CBo* const cbo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+  if (cbo == NULL) {
+
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the success
+  bool success = true;
+
+  // If the file is not empty
+  if (GSetNbElem(&(that->lines)) > 1) {
+
+    // Shortcuts to the bitsets
+    const uint64_t* blank = that->lineFlags[CBoLineFlag_blank];
+    const uint64_t* comment = that->lineFlags[CBoLineFlag_comment];
+    const uint64_t* openCurlyAtTail =
+      that->lineFlags[CBoLineFlag_openCurlyAtTail];
+
+    // Loop on the words of the bitsets
+    for (
+      unsigned int iWord = 0;
+      iWord < that->nbWord &&
+      CBoFileIsErrorBudgetSpent(that) == false;
+      ++iWord) {
+
+      // A line is in error if the previous line is not a comment and
+      // ends with an opening curly brace, and the line is not empty
+      uint64_t word =
+        CBoBitsetGetPrevWord(
+          openCurlyAtTail,
+          iWord) &
+        ~CBoBitsetGetPrevWord(
+          comment,
+          iWord) &
+        ~blank[iWord];
+
+      // Add the errors of this word to the file
+      bool noError =
+        CBoFileAddErrorsFromWord(
+          that,
+          word,
+          iWord,
+          CBoErrorType_EmptyLineAfterOpeningCurlyBrace);
+      if (noError == false) {
 
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckContinuationMark %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
+        // Update the success flag
+        success = false;
 
-      fprintf(
-        cbo->stream,
-        " OK");
+      }
 
     }
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckEmptyLineAfterOpeningCurlyBrace",
+      success);
 
   }
 
@@ -1991,10 +15857,10 @@ bool CBoFileCheckContinuationMark(
 
 }
 
-// Check there is an empty line before closing curly braces of the
+// Check there is an empty line after closing curly braces of the
 // CBoFile 'that' with the CBo 'cbo'
 // Return true if there was no problem, else false
-bool CBoFileCheckEmptyLineBeforeClosingCurlyBrace(
+bool CBoFileCheckEmptyLineAfterClosingCurlyBrace(
   CBoFile* const that,
       CBo* const cbo) {
 
@@ -2024,108 +15890,136 @@ bool CBoFileCheckEmptyLineBeforeClosingCurlyBrace(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 1) {
 
-    // Variable to memorize the previous non comment line
-    CBoLine* prevLine = NULL;
+    // Shortcuts to the bitsets
+    const uint64_t* blank = that->lineFlags[CBoLineFlag_blank];
+    const uint64_t* comment = that->lineFlags[CBoLineFlag_comment];
+    const uint64_t* closeCurlyAtTail =
+      that->lineFlags[CBoLineFlag_closeCurlyAtTail];
+
+    // Loop on the words of the bitsets
+    for (
+      unsigned int iWord = 0;
+      iWord < that->nbWord &&
+      CBoFileIsErrorBudgetSpent(that) == false;
+      ++iWord) {
+
+      // A line is in error if the previous line is not a comment and
+      // ends with a closing curly brace, and the line is not empty
+      uint64_t word =
+        CBoBitsetGetPrevWord(
+          closeCurlyAtTail,
+          iWord) &
+        ~CBoBitsetGetPrevWord(
+          comment,
+          iWord) &
+        ~blank[iWord];
+
+      // Add the errors of this word to the file
+      bool noError =
+        CBoFileAddErrorsFromWord(
+          that,
+          word,
+          iWord,
+          CBoErrorType_EmptyLineAfterClosingCurlyBrace);
+      if (noError == false) {
 
-    // Declare an iterator on the lines
-    GSetIterForward iter =
-      GSetIterForwardCreateStatic(&(that->lines));
+        // Update the success flag
+        success = false;
 
-    // Loop on the lines
-    unsigned int iLine = 0;
-    do {
+      }
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckEmptyLineBeforeClosingCurlyBrace %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
+    }
 
-      // Get the line
-      CBoLine* line = GSetIterGet(&iter);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckEmptyLineAfterClosingCurlyBrace",
+      success);
 
-      // Get the length of the line
-      unsigned int length = CBoLineGetLength(line);
+  }
 
-      // Get the length of the previous line
-      unsigned int lengthPrevLine = 0;
-      if (prevLine != NULL)
-        lengthPrevLine = CBoLineGetLength(prevLine);
+  // Return the successfull code
+  return success;
 
-      // Get the position of the head of line and previous line
-      unsigned int posHead = CBoLineGetPosHead(line);
+}
 
-      // If the line is not empty and starts with a closing curly
-      // brace and the previous line is not empty and not a comment and
-      // not terminating by antislash
-      if (
-        length > 0 &&
-        prevLine != NULL &&
-        CBoLineGetLength(prevLine) != 0 &&
-        CBoLineIsComment(prevLine) == false &&
-        line->str[posHead] == '}' &&
-        (prevLine == NULL || prevLine->str[lengthPrevLine- 1] != '\\')) {
+// Check there is no several blank lines in the
+// CBoFile 'that' with the CBo 'cbo'
+// Return true if there was no problem, else false
+bool CBoFileCheckSeveralBlankLines(
+  CBoFile* const that,
+      CBo* const cbo) {
 
-        // Update the success flag
-        success = false;
+#if BUILDMODE == 0
+  if (that == NULL) {
 
-        // Create the error
-        CBoError* error =
-          CBoErrorCreate(
-            that,
-            line,
-            iLine + 1,
-            CBoErrorType_EmptyLineBeforeClosingCurlyBrace);
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'that' is null");
+    PBErrCatch(CBoErr);
 
-        // Add the error to the file
-        CBoFileAddError(
-          that,
-          error);
+  }
 
-      }
+  if (cbo == NULL) {
 
-      // If the line is not a comment
-      if (CBoLineIsComment(line) == false) {
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'cbo' is null");
+    PBErrCatch(CBoErr);
 
-        // Update the previous line
-        prevLine = line;
+  }
 
-      }
+#endif
 
-      ++iLine;
+  // Declare a variable to memorize the success
+  bool success = true;
 
-    } while (GSetIterStep(&iter));
+  // If the file is not empty
+  if (GSetNbElem(&(that->lines)) > 1) {
 
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckEmptyLineBeforeClosingCurlyBrace %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
+    // Shortcut to the bitset
+    const uint64_t* blank = that->lineFlags[CBoLineFlag_blank];
+
+    // Loop on the words of the bitsets
+    for (
+      unsigned int iWord = 0;
+      iWord < that->nbWord &&
+      CBoFileIsErrorBudgetSpent(that) == false;
+      ++iWord) {
+
+      // A line is in error if it and the previous line are empty
+      uint64_t word =
+        CBoBitsetGetPrevWord(
+          blank,
+          iWord) &
+        blank[iWord];
+
+      // Add the errors of this word to the file
+      bool noError =
+        CBoFileAddErrorsFromWord(
+          that,
+          word,
+          iWord,
+          CBoErrorType_SeveralBlankLine);
+      if (noError == false) {
 
-      fprintf(
-        cbo->stream,
-        " OK");
+        // Update the success flag
+        success = false;
+
+      }
 
     }
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckSeveralBlankLine",
+      success);
 
   }
 
@@ -2134,10 +16028,10 @@ bool CBoFileCheckEmptyLineBeforeClosingCurlyBrace(
 
 }
 
-// Check there is an empty line after opening curly braces of the
+// Check there is a space after a comma and no before in lines of the
 // CBoFile 'that' with the CBo 'cbo'
 // Return true if there was no problem, else false
-bool CBoFileCheckEmptyLineAfterOpeningCurlyBrace(
+bool CBoFileCheckSpaceAroundComma(
   CBoFile* const that,
       CBo* const cbo) {
 
@@ -2167,50 +16061,23 @@ bool CBoFileCheckEmptyLineAfterOpeningCurlyBrace(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
-  if (GSetNbElem(&(that->lines)) > 1) {
-
-    // Variable to memorize the previous line
-    CBoLine* prevLine = NULL;
+  if (GSetNbElem(&(that->lines)) > 0) {
 
     // Declare an iterator on the lines
     GSetIterForward iter =
       GSetIterForwardCreateStatic(&(that->lines));
 
-    // Skip the first line
-    prevLine = GSetIterGet(&iter);
-
     // Loop on the lines
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckEmptyLineAfterOpeningCurlyBrace %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
-      // Get the length of the line and previous line
-      unsigned int length = CBoLineGetLength(line);
-      unsigned int prevLength = CBoLineGetLength(prevLine);
-
-      // If the previous line is not a comment and ends with a
-      // closing curly brace and the line is not empty
-      if (
-        prevLength > 0 &&
-        CBoLineIsComment(prevLine) == false &&
-        prevLine->str[prevLength - 1] == '{' &&
-        length != 0) {
+      // If the line breaks the rule
+      unsigned int mask = (1u << CBoRuleId_SpaceAroundComma);
+      if ((line->localErrors & mask) != 0) {
 
         // Update the success flag
         success = false;
@@ -2221,7 +16088,7 @@ bool CBoFileCheckEmptyLineAfterOpeningCurlyBrace(
             that,
             line,
             iLine + 1,
-            CBoErrorType_EmptyLineAfterOpeningCurlyBrace);
+            CBoErrorType_SpaceAroundComma);
 
         // Add the error to the file
         CBoFileAddError(
@@ -2230,31 +16097,17 @@ bool CBoFileCheckEmptyLineAfterOpeningCurlyBrace(
 
       }
 
-      prevLine = line;
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckEmptyLineAfterOpeningCurlyBrace %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckSpaceAroundComma",
+      success);
 
   }
 
@@ -2263,10 +16116,10 @@ bool CBoFileCheckEmptyLineAfterOpeningCurlyBrace(
 
 }
 
-// Check there is an empty line after closing curly braces of the
+// Check there is no space before semicolon in lines of the
 // CBoFile 'that' with the CBo 'cbo'
 // Return true if there was no problem, else false
-bool CBoFileCheckEmptyLineAfterClosingCurlyBrace(
+bool CBoFileCheckSpaceAroundSemicolon(
   CBoFile* const that,
       CBo* const cbo) {
 
@@ -2296,50 +16149,23 @@ bool CBoFileCheckEmptyLineAfterClosingCurlyBrace(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
-  if (GSetNbElem(&(that->lines)) > 1) {
-
-    // Variable to memorize the previous line
-    CBoLine* prevLine = NULL;
+  if (GSetNbElem(&(that->lines)) > 0) {
 
     // Declare an iterator on the lines
     GSetIterForward iter =
       GSetIterForwardCreateStatic(&(that->lines));
 
-    // Skip the first line
-    prevLine = GSetIterGet(&iter);
-
     // Loop on the lines
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckEmptyLineAfterClosingCurlyBrace %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
-      // Get the length of the line and previous line
-      unsigned int length = CBoLineGetLength(line);
-      unsigned int prevLength = CBoLineGetLength(prevLine);
-
-      // If the line is a closing curly brace and the previous line
-      // is not empty or a comment
-      if (
-        prevLength > 0 &&
-        CBoLineIsComment(prevLine) == false &&
-        prevLine->str[prevLength - 1] == '}' &&
-        length != 0) {
+      // If the line breaks the rule
+      unsigned int mask = (1u << CBoRuleId_SpaceAroundSemicolon);
+      if ((line->localErrors & mask) != 0) {
 
         // Update the success flag
         success = false;
@@ -2350,7 +16176,7 @@ bool CBoFileCheckEmptyLineAfterClosingCurlyBrace(
             that,
             line,
             iLine + 1,
-            CBoErrorType_EmptyLineAfterClosingCurlyBrace);
+            CBoErrorType_SpaceAroundSemicolon);
 
         // Add the error to the file
         CBoFileAddError(
@@ -2359,31 +16185,17 @@ bool CBoFileCheckEmptyLineAfterClosingCurlyBrace(
 
       }
 
-      prevLine = line;
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckEmptyLineAfterClosingCurlyBrace %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckSpaceAroundSemicolon",
+      success);
 
   }
 
@@ -2392,10 +16204,14 @@ bool CBoFileCheckEmptyLineAfterClosingCurlyBrace(
 
 }
 
-// Check there is no several blank lines in the
-// CBoFile 'that' with the CBo 'cbo'
+// Check there is a space around arythmetic/boolean operators
+// in lines of the CBoFile 'that' with the CBo 'cbo'
+// The lines are scanned in one pass by a table driven state machine
+// classifying each operator as binary, unary, pointer, increment,
+// compound assignment or '->' according to the previous significant
+// token, only binary operators and compound assignments require spaces
 // Return true if there was no problem, else false
-bool CBoFileCheckSeveralBlankLines(
+bool CBoFileCheckSpaceAroundOperator(
   CBoFile* const that,
       CBo* const cbo) {
 
@@ -2425,278 +16241,294 @@ bool CBoFileCheckSeveralBlankLines(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
-  if (GSetNbElem(&(that->lines)) > 1) {
+  if (GSetNbElem(&(that->lines)) > 0) {
 
-    // Variable to memorize the previous line
-    CBoLine* prevLine = NULL;
+    // Declare a variable to memorize the lexical state, which is kept
+    // from one line to the next for the multiline comments
+    unsigned char lexState = CBoOpLexState_code;
 
     // Declare an iterator on the lines
     GSetIterForward iter =
       GSetIterForwardCreateStatic(&(that->lines));
 
-    // Skip the first line
-    prevLine = GSetIterGet(&iter);
-
     // Loop on the lines
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckSeveralBlankLine %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
-      // Get the length of the line and previous line
-      unsigned int length = CBoLineGetLength(line);
-      unsigned int prevLength = CBoLineGetLength(prevLine);
+      // If the line is not a precompiler command
+      bool isPrecompilCmd =
+        CBoFileIsLinePrecompilCmd(
+          that,
+          iLine);
+      if (isPrecompilCmd == false) {
 
-      // If the line is a closing curly brace and the previous line
-      // is not empty or a comment
-      if (prevLength == 0 && length == 0) {
+        // Shortcut to the content of the line
+        const unsigned char* str = (const unsigned char*)(line->str);
 
-        // Update the success flag
-        success = false;
+        // Get the position of the head of the line
+        unsigned int posHead = CBoLineGetPosHead(line);
 
-        // Create the error
-        CBoError* error =
-          CBoErrorCreate(
+        // Declare variables to memorize the two previous significant
+        // tokens
+        CBoOpToken prevToken = CBoOpToken_statement;
+        CBoOpToken prevPrevToken = CBoOpToken_statement;
+
+        // Declare a flag to memorize if there is an error on the line,
+        // if the rule is suppressed on the line it's still scanned to
+        // follow the multiline comments but no error is reported
+        bool flagError =
+          CBoFileIsSuppressed(
             that,
-            line,
-            iLine + 1,
-            CBoErrorType_SeveralBlankLine);
+            iLine,
+            CBoErrorType_SpaceAroundOperator);
 
-        // Add the error to the file
-        CBoFileAddError(
-          that,
-          error);
+        // Loop on the char of the line
+        unsigned int pos = 0;
+        while (str[pos] != '\0') {
 
-      }
+          // Get the class of the current char
+          unsigned char charClass = cboOpCharClass[str[pos]];
 
-      prevLine = line;
-      ++iLine;
+          // If we are in a string, a character or a comment
+          if (lexState != CBoOpLexState_code) {
 
-    } while (GSetIterStep(&iter));
+            // Move to the next lexical state
+            lexState = cboOpLexTransition[lexState][charClass];
 
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckSeveralBlankLine %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
+            // If we are back in the code, a string or character has
+            // been closed
+            if (
+              lexState == CBoOpLexState_code &&
+              charClass != CBoOpCharClass_slash) {
 
-      fprintf(
-        cbo->stream,
-        " OK");
+              prevPrevToken = prevToken;
+              prevToken = CBoOpToken_operand;
 
-    }
+            }
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+            ++pos;
 
-  }
+          // Else, if it's a space, skip it
+          } else if (charClass == CBoOpCharClass_space) {
 
-  // Return the successfull code
-  return success;
+            ++pos;
 
-}
+          // Else, if it's an identifier
+          } else if (charClass == CBoOpCharClass_ident) {
 
-// Check there is a space after a comma and no before in lines of the
-// CBoFile 'that' with the CBo 'cbo'
-// Return true if there was no problem, else false
-bool CBoFileCheckSpaceAroundComma(
-  CBoFile* const that,
-      CBo* const cbo) {
+            // Skip the identifier
+            unsigned int posStart = pos;
+            do {
 
-#if BUILDMODE == 0
-  if (that == NULL) {
+              ++pos;
+              charClass = cboOpCharClass[str[pos]];
 
-    CBoErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      CBoErr->_msg,
-      "'that' is null");
-    PBErrCatch(CBoErr);
+            } while (
+              charClass == CBoOpCharClass_ident ||
+              charClass == CBoOpCharClass_digit);
 
-  }
+            // Update the previous tokens
+            prevPrevToken = prevToken;
+            bool isKeyword =
+              CBoOpIsKeywordExpectingOperand(
+                (const char*)(str + posStart),
+                pos - posStart);
+            bool isType =
+              CBoOpIsTypeKeyword(
+                (const char*)(str + posStart),
+                pos - posStart);
+            if (isKeyword == true) {
 
-  if (cbo == NULL) {
+              prevToken = CBoOpToken_keyword;
 
-    CBoErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      CBoErr->_msg,
-      "'cbo' is null");
-    PBErrCatch(CBoErr);
+            } else if (isType == true) {
 
-  }
+              prevToken = CBoOpToken_type;
 
-#endif
+            } else {
 
-  // Declare a variable to memorize the success
-  bool success = true;
+              prevToken = CBoOpToken_ident;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
+            }
 
-  // If the file is not empty
-  if (GSetNbElem(&(that->lines)) > 0) {
+          // Else, if it's a number
+          } else if (
+            charClass == CBoOpCharClass_digit ||
+            (charClass == CBoOpCharClass_dot &&
+            cboOpCharClass[str[pos + 1]] == CBoOpCharClass_digit)) {
+
+            // Skip the number, the sign of the exponent is part of the
+            // number ('p' only for hexadecimal)
+            bool isHexa = (str[pos + 1] == 'x' || str[pos + 1] == 'X');
+            do {
+
+              ++pos;
+              charClass = cboOpCharClass[str[pos]];
+              if (
+                (str[pos] == '+' || str[pos] == '-') &&
+                (str[pos - 1] == 'p' || str[pos - 1] == 'P' ||
+                (isHexa == false &&
+                (str[pos - 1] == 'e' || str[pos - 1] == 'E')))) {
+
+                charClass = CBoOpCharClass_digit;
+
+              }
+
+            } while (
+              charClass == CBoOpCharClass_ident ||
+              charClass == CBoOpCharClass_digit ||
+              charClass == CBoOpCharClass_dot);
+
+            // Update the previous tokens
+            prevPrevToken = prevToken;
+            prevToken = CBoOpToken_operand;
 
-    // Declare an iterator on the lines
-    GSetIterForward iter =
-      GSetIterForwardCreateStatic(&(that->lines));
+          // Else, if it's the beginning of a comment
+          } else if (
+            charClass == CBoOpCharClass_slash &&
+            (str[pos + 1] == '/' || str[pos + 1] == '*')) {
 
-    // Loop on the lines
-    unsigned int iLine = 0;
-    do {
+            // If it's a single line comment
+            if (str[pos + 1] == '/') {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckSpaceAroundComma %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
+              // Skip the end of the line
+              while (str[pos] != '\0') ++pos;
 
-      // Get the line
-      CBoLine* line = GSetIterGet(&iter);
+            // Else it's a multiline comment
+            } else {
 
-      // If the line is not a comment
-      if (CBoLineIsComment(line) == false) {
+              // Update the lexical state and skip the '/*'
+              lexState = CBoOpLexState_comment;
+              pos += 2;
 
-        // Get the length of the line
-        unsigned int length = CBoLineGetLength(line);
+            }
 
-        // Declare two flags to memorize the strings in the code
-        bool flagQuote = false;
-        bool flagDoubleQuote = false;
+          // Else, if it's an operator
+          } else if (cboOpDesc[str[pos]].isOperator == true) {
+
+            // Get the kind and length of the operator
+            unsigned int lengthOp = 1;
+            CBoOpKind kind =
+              CBoOpGetKind(
+                str,
+                pos,
+                prevToken,
+                prevPrevToken,
+                &lengthOp);
+
+            // If the operator requires spaces around it and they are
+            // not there
+            if (
+              (kind == CBoOpKind_binary ||
+              kind == CBoOpKind_compound) &&
+              ((pos != posHead &&
+              cboOpCharClass[str[pos - 1]] != CBoOpCharClass_space) ||
+              (cboOpCharClass[str[pos + lengthOp]] != CBoOpCharClass_space &&
+              str[pos + lengthOp] != '\0'))) {
 
-        // Loop on the char of the line
-        for (
-          unsigned int iChar = 0;
-          iChar < length;
-          ++iChar) {
+              // If it's the first error on this line
+              if (flagError == false) {
+
+                // Update the success flag
+                success = false;
+                flagError = true;
 
-          if (line->str[iChar] == '\'') {
+                // Create the error
+                CBoError* error =
+                  CBoErrorCreate(
+                    that,
+                    line,
+                    iLine + 1,
+                    CBoErrorType_SpaceAroundOperator);
 
-            if (flagDoubleQuote == false) {
+                // Add the error to the file
+                CBoFileAddError(
+                  that,
+                  error);
 
-              flagQuote = !flagQuote;
+              }
 
             }
 
-          } else if (line->str[iChar] == '"') {
+            // Update the previous tokens, the increment operators leave
+            // them unchanged
+            if (kind == CBoOpKind_pointer) {
+
+              prevPrevToken = prevToken;
+              prevToken = CBoOpToken_pointer;
 
-            if (flagQuote == false) {
+            } else if (kind != CBoOpKind_increment) {
 
-              flagDoubleQuote = !flagDoubleQuote;
+              prevPrevToken = prevToken;
+              prevToken = CBoOpToken_operator;
 
             }
 
-          }
+            // Skip the operator
+            pos += lengthOp;
 
-          // If we are not in a string
-          if (flagQuote == false && flagDoubleQuote == false) {
+          // Else, it's another character
+          } else {
 
-            // If the char is a comma and the previous one is a space
-            if (
-              line->str[iChar] == ',' &&
-              (iChar == 0 ||
-              line->str[iChar - 1] == ' ' ||
-              line->str[iChar - 1] == '\t')) {
+            // Update the previous tokens
+            prevPrevToken = prevToken;
+            if (str[pos] == ',' || charClass == CBoOpCharClass_open) {
 
-              // Update the success flag
-              success = false;
+              prevToken = CBoOpToken_start;
 
-              // Create the error
-              CBoError* error =
-                CBoErrorCreate(
-                  that,
-                  line,
-                  iLine + 1,
-                  CBoErrorType_SpaceAroundComma);
+            } else if (charClass == CBoOpCharClass_separator) {
 
-              // Add the error to the file
-              CBoFileAddError(
-                that,
-                error);
+              prevToken = CBoOpToken_statement;
 
-              // Skip the end of the line
-              iChar = length;
+            } else if (charClass == CBoOpCharClass_close) {
 
-            // If the char is a comma and the next one is a space
-            } else if (
-              line->str[iChar] == ',' &&
-              line->str[iChar + 1] != ' ' &&
-              iChar != length - 1) {
+              bool isCast =
+                CBoOpIsCast(
+                  str,
+                  pos);
+              prevToken = (isCast ? CBoOpToken_cast : CBoOpToken_operand);
 
-              // Update the success flag
-              success = false;
+            } else {
 
-              // Create the error
-              CBoError* error =
-                CBoErrorCreate(
-                  that,
-                  line,
-                  iLine + 1,
-                  CBoErrorType_SpaceAroundComma);
+              prevToken = CBoOpToken_operator;
 
-              // Add the error to the file
-              CBoFileAddError(
-                that,
-                error);
+            }
 
-              // Skip the end of the line
-              iChar = length;
+            // Move to the next lexical state (for the quotes)
+            lexState = cboOpLexTransition[lexState][charClass];
 
-            }
+            ++pos;
 
           }
 
         }
 
-      }
+        // Strings and characters can't span several lines
+        if (
+          lexState != CBoOpLexState_comment &&
+          lexState != CBoOpLexState_commentStar) {
 
-      ++iLine;
+          lexState = CBoOpLexState_code;
 
-    } while (GSetIterStep(&iter));
+        }
 
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckSpaceAroundComma %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
+      }
 
-      fprintf(
-        cbo->stream,
-        " OK");
+      ++iLine;
 
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckSpaceAroundOperator",
+      success);
 
   }
 
@@ -2705,407 +16537,388 @@ bool CBoFileCheckSpaceAroundComma(
 
 }
 
-// Check there is no space before semicolon in lines of the
-// CBoFile 'that' with the CBo 'cbo'
-// Return true if there was no problem, else false
-bool CBoFileCheckSpaceAroundSemicolon(
-  CBoFile* const that,
-      CBo* const cbo) {
+// Get the kind of the operator at position 'pos' in the line 'str'
+// given the two previous significant tokens 'prevToken' and
+// 'prevPrevToken', and memorize its length in 'length'
+// Return the kind of the operator
+CBoOpKind CBoOpGetKind(
+  const unsigned char* const str,
+          const unsigned int pos,
+            const CBoOpToken prevToken,
+            const CBoOpToken prevPrevToken,
+         unsigned int* const length) {
 
 #if BUILDMODE == 0
-  if (that == NULL) {
+  if (str == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'that' is null");
+      "'str' is null");
     PBErrCatch(CBoErr);
 
   }
 
-  if (cbo == NULL) {
+  if (length == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'cbo' is null");
+      "'length' is null");
     PBErrCatch(CBoErr);
 
   }
 
 #endif
 
-  // Declare a variable to memorize the success
-  bool success = true;
+  // Get the description of the operator and the next character
+  const CBoOpDesc* desc = cboOpDesc + str[pos];
+  unsigned char next = str[pos + 1];
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
+  // By default the operator is one character long
+  *length = 1;
 
-  // If the file is not empty
-  if (GSetNbElem(&(that->lines)) > 0) {
+  // If it's the '->' operator
+  if (str[pos] == '-' && next == '>') {
 
-    // Declare an iterator on the lines
-    GSetIterForward iter =
-      GSetIterForwardCreateStatic(&(that->lines));
+    *length = 2;
+    return CBoOpKind_arrow;
 
-    // Loop on the lines
-    unsigned int iLine = 0;
-    do {
+  }
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckSpaceAroundSemicolon %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
+  // If the operator is doubled and it has a meaning (++, --, &&, ||)
+  if (next == str[pos] && desc->doubleKind != CBoOpKind_none) {
 
-      // Get the line
-      CBoLine* line = GSetIterGet(&iter);
+    // Compound assignment of a doubled operator is not used in C
+    *length = 2;
+    return desc->doubleKind;
 
-      // Get the length of the line
-      unsigned int length = CBoLineGetLength(line);
+  }
 
-      // Declare two flags to memorize the strings in the code
-      bool flagQuote = false;
-      bool flagDoubleQuote = false;
+  // If it's a compound assignment
+  if (next == '=') {
 
-      // Loop on the char of the line
-      for (
-        unsigned int iChar = 0;
-        iChar < length;
-        ++iChar) {
+    *length = 2;
+    return CBoOpKind_compound;
 
-        if (line->str[iChar] == '\'') {
+  }
 
-          if (flagDoubleQuote == false) {
+  // Check if an operand is expected at this position
+  bool expectOperand = (
+    prevToken == CBoOpToken_start ||
+    prevToken == CBoOpToken_statement ||
+    prevToken == CBoOpToken_keyword ||
+    prevToken == CBoOpToken_operator ||
+    prevToken == CBoOpToken_cast);
 
-            flagQuote = !flagQuote;
+  // If an operand is expected and the operator can be unary
+  if (expectOperand == true && desc->canBeUnary == true) {
 
-          }
+    return CBoOpKind_unary;
 
-        } else if (line->str[iChar] == '"') {
+  }
 
-          if (flagQuote == false) {
+  // If the operator can't be a pointer operator, it's binary
+  if (desc->canBePointer == false) {
 
-            flagDoubleQuote = !flagDoubleQuote;
+    return CBoOpKind_binary;
 
-          }
+  }
 
-        }
+  // Skip the following pointer operators and spaces to check if the
+  // operator ends a type name in a cast or a prototype
+  unsigned int posNext = pos + 1;
+  while (
+    cboOpCharClass[str[posNext]] == CBoOpCharClass_star ||
+    cboOpCharClass[str[posNext]] == CBoOpCharClass_space) {
 
-        // If we are not in a string
-        if (flagQuote == false && flagDoubleQuote == false) {
+    ++posNext;
 
-          // If the char is a semicolon and the previous one is a space
-          if (
-            line->str[iChar] == ';' &&
-            (iChar == 0 ||
-            line->str[iChar - 1] == ' ' ||
-            line->str[iChar - 1] == '\t')) {
+  }
 
-            // Update the success flag
-            success = false;
+  // The operator is a pointer operator only in a declaration: after
+  // another pointer operator, after a type keyword or a qualifier,
+  // after the first identifier of a statement or the one following a
+  // type keyword, at the end of a type name, or attached to a type
+  // name and followed by a space as in the parameters of a prototype
+  if (
+    prevToken == CBoOpToken_pointer ||
+    prevToken == CBoOpToken_type ||
+    (prevToken == CBoOpToken_ident &&
+    (prevPrevToken == CBoOpToken_statement ||
+    prevPrevToken == CBoOpToken_type)) ||
+    str[posNext] == ')' ||
+    str[posNext] == ',' ||
+    (prevToken == CBoOpToken_ident &&
+    cboOpCharClass[str[pos - 1]] == CBoOpCharClass_ident &&
+    cboOpCharClass[str[posNext - 1]] == CBoOpCharClass_space)) {
+
+    return CBoOpKind_pointer;
 
-            // Create the error
-            CBoError* error =
-              CBoErrorCreate(
-                that,
-                line,
-                iLine + 1,
-                CBoErrorType_SpaceAroundSemicolon);
+  }
 
-            // Add the error to the file
-            CBoFileAddError(
-              that,
-              error);
+  // Else the operator is binary
+  return CBoOpKind_binary;
 
-            // Skip the end of the line
-            iChar = length;
+}
 
-          }
+// Check if the 'length' first characters of 'str' are a keyword
+// followed by an operand (return, case, sizeof)
+// Return true if it's such a keyword, else false
+bool CBoOpIsKeywordExpectingOperand(
+   const char* const str,
+  const unsigned int length) {
 
-        }
+#if BUILDMODE == 0
+  if (str == NULL) {
 
-      }
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'str' is null");
+    PBErrCatch(CBoErr);
 
-      ++iLine;
+  }
 
-    } while (GSetIterStep(&iter));
+#endif
 
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckSpaceAroundSemicolon %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
+  // Compare the identifier to the keywords, only when the length and
+  // first character match
+  if (length == 4 && str[0] == 'c') {
 
-      fprintf(
-        cbo->stream,
-        " OK");
+    return (
+      strncmp(
+        str,
+        "case",
+        4) == 0);
 
-    }
+  } else if (length == 6 && str[0] == 'r') {
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    return (
+      strncmp(
+        str,
+        "return",
+        6) == 0);
+
+  } else if (length == 6 && str[0] == 's') {
+
+    return (
+      strncmp(
+        str,
+        "sizeof",
+        6) == 0);
 
   }
 
-  // Return the successfull code
-  return success;
+  // If we reach here, it's not a keyword followed by an operand
+  return false;
 
 }
 
-// Check there is a space around arythmetic/boolean operators
-// in lines of the CBoFile 'that' with the CBo 'cbo'
-// Return true if there was no problem, else false
-bool CBoFileCheckSpaceAroundOperator(
-  CBoFile* const that,
-      CBo* const cbo) {
+// Check if the 'length' first characters of 'str' are a type keyword
+// or a qualifier
+// Return true if it's such a keyword, else false
+bool CBoOpIsTypeKeyword(
+   const char* const str,
+  const unsigned int length) {
 
 #if BUILDMODE == 0
-  if (that == NULL) {
-
-    CBoErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      CBoErr->_msg,
-      "'that' is null");
-    PBErrCatch(CBoErr);
-
-  }
-
-  if (cbo == NULL) {
+  if (str == NULL) {
 
     CBoErr->_type = PBErrTypeNullPointer;
     sprintf(
       CBoErr->_msg,
-      "'cbo' is null");
+      "'str' is null");
     PBErrCatch(CBoErr);
 
   }
 
 #endif
 
-  // Declare a variable to memorize the success
-  bool success = true;
-
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
-  // Declare a variable to memorize the operators
-  // TODO Exclude '*' and '&' due to complication when used as
-  // pointer operator
-  // TODO better rule for '-' also due to complication when used
-  // as pointer operator
-  char* operators = "+-/|";
-
-  // If the file is not empty
-  if (GSetNbElem(&(that->lines)) > 0) {
-
-    // Declare an iterator on the lines
-    GSetIterForward iter =
-      GSetIterForwardCreateStatic(&(that->lines));
-
-    // Loop on the lines
-    unsigned int iLine = 0;
-    do {
-
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckSpaceAroundOperator %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
+  // Get the number of type keywords
+  unsigned int nbKeyword =
+    sizeof(cboOpTypeKeywords) / sizeof(cboOpTypeKeywords[0]);
 
-      // Get the line
-      CBoLine* line = GSetIterGet(&iter);
-
-      // Get the length of the line
-      unsigned int length = CBoLineGetLength(line);
-
-      // If the line is not a comment or a precompiler command
-      bool isPrecompilCmd =
-        CBoFileIsLinePrecompilCmd(
-          that,
-          iLine);
-      if (
-        CBoLineIsComment(line) == false &&
-        isPrecompilCmd == false) {
+  // Loop on the type keywords until one matches the identifier
+  bool isType = false;
+  for (
+    unsigned int iKeyword = 0;
+    iKeyword < nbKeyword && isType == false;
+    ++iKeyword) {
+
+    // Compare the identifier to the keyword, only when the first
+    // character matches
+    const char* keyword = cboOpTypeKeywords[iKeyword];
+    isType = (
+      keyword[0] == str[0] &&
+      strlen(keyword) == length &&
+      strncmp(
+        str,
+        keyword,
+        length) == 0);
 
-        // Declare two flags to memorize the strings in the code
-        bool flagQuote = false;
-        bool flagDoubleQuote = false;
+  }
 
-        // Loop on the char of the line
-        for (
-          unsigned int iChar = 0;
-          iChar < length;
-          ++iChar) {
+  // Return the result
+  return isType;
 
-          if (line->str[iChar] == '\'') {
+}
 
-            if (flagDoubleQuote == false) {
+// Check if the closing parenthesis at position 'pos' in the line 'str'
+// ends a cast, i.e. the parenthesis hold a type name and are not the
+// ones of a function call or a sizeof
+// Return true if it's a cast, else false
+bool CBoOpIsCast(
+  const unsigned char* const str,
+          const unsigned int pos) {
 
-              flagQuote = !flagQuote;
+#if BUILDMODE == 0
+  if (str == NULL) {
 
-            }
+    CBoErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      CBoErr->_msg,
+      "'str' is null");
+    PBErrCatch(CBoErr);
 
-          } else if (line->str[iChar] == '"') {
+  }
 
-            if (flagQuote == false) {
+#endif
 
-              flagDoubleQuote = !flagDoubleQuote;
+  // Search backward the opening parenthesis on the same line, a type
+  // name is only made of identifiers, spaces and pointer operators
+  unsigned int posOpen = pos;
+  bool isTypeChar = true;
+  while (posOpen > 0 && isTypeChar == true && str[posOpen - 1] != '(') {
 
-            }
+    --posOpen;
+    unsigned char charClass = cboOpCharClass[str[posOpen]];
+    isTypeChar = (
+      charClass == CBoOpCharClass_ident ||
+      charClass == CBoOpCharClass_digit ||
+      charClass == CBoOpCharClass_space ||
+      charClass == CBoOpCharClass_star);
 
-          }
+  }
 
-          // If we are not in a string
-          if (flagQuote == false && flagDoubleQuote == false) {
+  // If the opening parenthesis hasn't been found, it's not a cast
+  if (isTypeChar == false || posOpen == 0) {
 
-            // Search for the character in the possible operators
-            char* ptr =
-              strchr(
-                operators,
-                line->str[iChar]);
+    return false;
 
-            // If the char is an operator
-            if (ptr != NULL) {
+  }
 
-              // If there is not the needed space before the operator
-              if (
-                line->str[iChar] != '-' &&
-                iChar > 0 &&
-                line->str[iChar - 1] != ' ' &&
-                line->str[iChar - 1] != line->str[iChar] &&
-                line->str[iChar + 1] != line->str[iChar]) {
+  // Get the position of the last character of the content of the
+  // parenthesis which is not a space
+  unsigned int posLast = pos;
+  while (
+    posLast > posOpen &&
+    cboOpCharClass[str[posLast - 1]] == CBoOpCharClass_space) {
 
-                // Update the success flag
-                success = false;
+    --posLast;
 
-                // Create the error
-                CBoError* error =
-                  CBoErrorCreate(
-                    that,
-                    line,
-                    iLine + 1,
-                    CBoErrorType_SpaceAroundOperator);
+  }
 
-                // Add the error to the file
-                CBoFileAddError(
-                  that,
-                  error);
+  // If the content is empty, it's not a cast
+  if (posLast == posOpen) {
 
-                // Skip the end of the line
-                iChar = length;
+    return false;
 
-              // If there is not the needed space after the operator '-'
-              } else if (
-                line->str[iChar] == '-' &&
-                line->str[iChar + 1] != ' ' &&
-                line->str[iChar + 1] != line->str[iChar] &&
-                line->str[iChar + 1] != '=' &&
-                line->str[iChar + 1] < '0' &&
-                line->str[iChar + 1] > '9' &&
-                line->str[iChar + 1] != '>') {
+  }
 
-                // Update the success flag
-                success = false;
+  // The content is a type name if it ends with a pointer operator, or
+  // contains a type keyword or an identifier ending with '_t'
+  bool isTypeName = (str[posLast - 1] == '*');
+  unsigned int posIdent = posOpen;
+  while (posIdent < posLast && isTypeName == false) {
 
-                // Create the error
-                CBoError* error =
-                  CBoErrorCreate(
-                    that,
-                    line,
-                    iLine + 1,
-                    CBoErrorType_SpaceAroundOperator);
+    // If it's the start of an identifier
+    if (cboOpCharClass[str[posIdent]] == CBoOpCharClass_ident) {
 
-                // Add the error to the file
-                CBoFileAddError(
-                  that,
-                  error);
+      // Skip the identifier
+      unsigned int posStart = posIdent;
+      while (
+        cboOpCharClass[str[posIdent]] == CBoOpCharClass_ident ||
+        cboOpCharClass[str[posIdent]] == CBoOpCharClass_digit) {
 
-                // Skip the end of the line
-                iChar = length;
+        ++posIdent;
 
-              // If there is not the needed space after the operator
-              // other than '-'
-              } else if (
-                line->str[iChar] != '-' &&
-                iChar < length - 1 &&
-                line->str[iChar + 1] != ' ' &&
-                line->str[iChar + 1] != line->str[iChar] &&
-                line->str[iChar + 1] != '=' &&
-                line->str[iChar - 1] != line->str[iChar]) {
+      }
 
-                // Update the success flag
-                success = false;
+      // Check if the identifier is a type
+      unsigned int lengthIdent = posIdent - posStart;
+      isTypeName = (
+        CBoOpIsTypeKeyword(
+          (const char*)(str + posStart),
+          lengthIdent) ||
+        (lengthIdent > 2 &&
+        str[posIdent - 2] == '_' &&
+        str[posIdent - 1] == 't'));
 
-                // Create the error
-                CBoError* error =
-                  CBoErrorCreate(
-                    that,
-                    line,
-                    iLine + 1,
-                    CBoErrorType_SpaceAroundOperator);
+    } else {
 
-                // Add the error to the file
-                CBoFileAddError(
-                  that,
-                  error);
+      ++posIdent;
 
-                // Skip the end of the line
-                iChar = length;
+    }
 
-              }
+  }
 
-            }
+  // If the content is not a type name, it's not a cast
+  if (isTypeName == false) {
 
-          }
+    return false;
 
-        }
+  }
 
-      }
+  // Get the position of the last character before the opening
+  // parenthesis which is not a space
+  unsigned int posBefore = posOpen - 1;
+  while (
+    posBefore > 0 &&
+    cboOpCharClass[str[posBefore - 1]] == CBoOpCharClass_space) {
 
-      ++iLine;
+    --posBefore;
 
-    } while (GSetIterStep(&iter));
+  }
 
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckSpaceAroundOperator %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
+  // If the parenthesis follow an operand, it's not a cast
+  if (posBefore > 0) {
 
-      fprintf(
-        cbo->stream,
-        " OK");
+    unsigned char charClass = cboOpCharClass[str[posBefore - 1]];
+    if (charClass == CBoOpCharClass_close) {
+
+      return false;
 
     }
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // If the parenthesis follow an identifier, it's a cast only after
+    // 'return' or 'case' (not after a function name or 'sizeof')
+    if (
+      charClass == CBoOpCharClass_ident ||
+      charClass == CBoOpCharClass_digit) {
+
+      unsigned int posStart = posBefore;
+      while (
+        posStart > 0 &&
+        (cboOpCharClass[str[posStart - 1]] == CBoOpCharClass_ident ||
+        cboOpCharClass[str[posStart - 1]] == CBoOpCharClass_digit)) {
+
+        --posStart;
+
+      }
+
+      bool isKeyword =
+        CBoOpIsKeywordExpectingOperand(
+          (const char*)(str + posStart),
+          posBefore - posStart);
+      return (isKeyword == true && str[posStart] != 's');
+
+    }
 
   }
 
-  // Return the successfull code
-  return success;
+  // If we reach here, it's a cast
+  return true;
 
 }
 
@@ -3143,9 +16956,6 @@ bool CBoFileCheckNoCurlyBraceAtHead(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -3157,25 +16967,23 @@ bool CBoFileCheckNoCurlyBraceAtHead(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckNoCurlyBraceAtHead %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
       // Get the position of the head of the line
       unsigned int posHead = CBoLineGetPosHead(line);
 
-      // If the line starts with an opening curly brace
-      // and its closing brace is not on the same line
-      if (line->str[posHead] == '{') {
+      // If the rule is not suppressed on the line, and the line starts
+      // with an opening curly brace and its closing brace is not on the
+      // same line
+      bool isSuppressed =
+        CBoFileIsSuppressed(
+          that,
+          iLine,
+          CBoErrorType_NoCurlyBraceAtHead);
+      if (
+        isSuppressed == false &&
+        line->str[posHead] == '{') {
 
         // Get the position of its closing brace
         unsigned int posCloseBrace =
@@ -3208,28 +17016,15 @@ bool CBoFileCheckNoCurlyBraceAtHead(
 
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckNoCurlyBraceAtHead %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckNoCurlyBraceAtHead",
+      success);
 
   }
 
@@ -3271,9 +17066,6 @@ bool CBoFileCheckNoCurlyBraceAtTail(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -3285,16 +17077,6 @@ bool CBoFileCheckNoCurlyBraceAtTail(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckNoCurlyBraceAtTail %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
@@ -3304,11 +17086,23 @@ bool CBoFileCheckNoCurlyBraceAtTail(
       // Get the position of the head of the line
       unsigned int posHead = CBoLineGetPosHead(line);
 
-      // Get the position of the last closing curly brace
-      unsigned int posLastCloseBrace =
-        CBoLineGetPosLast(
-          line,
-          '}');
+      // Get the position of the last closing curly brace, if the rule
+      // is suppressed on the line it's not searched and the line is
+      // considered without closing curly brace
+      bool isSuppressed =
+        CBoFileIsSuppressed(
+          that,
+          iLine,
+          CBoErrorType_NoCurlyBraceAtTail);
+      unsigned int posLastCloseBrace = length;
+      if (isSuppressed == false) {
+
+        posLastCloseBrace =
+          CBoLineGetPosLast(
+            line,
+            '}');
+
+      }
 
       // If the last closing brace is not at the head of the line
       // and the line is not a comment
@@ -3348,28 +17142,15 @@ bool CBoFileCheckNoCurlyBraceAtTail(
 
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckNoCurlyBraceAtTail %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckNoCurlyBraceAtTail",
+      success);
 
   }
 
@@ -3411,9 +17192,6 @@ bool CBoFileCheckCharBeforeDot(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -3425,125 +17203,42 @@ bool CBoFileCheckCharBeforeDot(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckCharBeforeDot %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
-      // If the line is not a comment
-      if (CBoLineIsComment(line) == false) {
-
-        // Get the position of the head of the line
-        unsigned int posHead = CBoLineGetPosHead(line);
-
-        // Get the length of the line
-        unsigned int length = CBoLineGetLength(line);
-
-        // Declare two variables to manage strings
-        bool flagQuote = false;
-        bool flagDoubleQuote = false;
-
-        // Loop on the char in the line
-        for (
-          unsigned int iChar = 0;
-          iChar < length;
-          ++iChar) {
-
-          if (line->str[iChar] == '\'') {
-
-            if (flagDoubleQuote == false) {
-
-              flagQuote = !flagQuote;
-
-            }
-
-          } else if (line->str[iChar] == '"') {
-
-            if (flagQuote == false) {
-
-              flagDoubleQuote = !flagDoubleQuote;
-
-            }
-
-          }
-
-          // If we are not in a string
-          if (flagQuote == false && flagDoubleQuote == false) {
-
-            // If the dot is not at the head of the line and
-            // the char before the '.' is invalid
-            if (
-              line->str[iChar] == '.' &&
-              !(iChar > 0 && line->str[iChar - 1] == '.') &&
-              line->str[iChar + 1] != '.' &&
-              (iChar == 0 ||
-              (iChar != posHead &&
-              !(line->str[iChar - 1] >= 'a' && line->str[iChar - 1] <= 'z') &&
-              !(line->str[iChar - 1] >= 'A' && line->str[iChar - 1] <= 'Z') &&
-              !(line->str[iChar - 1] >= '0' && line->str[iChar - 1] <= '9') &&
-              line->str[iChar - 1] != ' ' &&
-              line->str[iChar - 1] != ']' &&
-              line->str[iChar - 1] != ')'))) {
-
-              // Update the success flag
-              success = false;
-
-              // Create the error
-              CBoError* error =
-                CBoErrorCreate(
-                  that,
-                  line,
-                  iLine + 1,
-                  CBoErrorType_CharBeforeDot);
-
-              // Add the error to the file
-              CBoFileAddError(
-                that,
-                error);
-
-              // Skip the end of the line
-              iChar = length;
+      // If the line breaks the rule
+      unsigned int mask = (1u << CBoRuleId_CharBeforeDot);
+      if ((line->localErrors & mask) != 0) {
 
-            }
+        // Update the success flag
+        success = false;
 
-          }
+        // Create the error
+        CBoError* error =
+          CBoErrorCreate(
+            that,
+            line,
+            iLine + 1,
+            CBoErrorType_CharBeforeDot);
 
-        }
+        // Add the error to the file
+        CBoFileAddError(
+          that,
+          error);
 
       }
 
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckCharBeforeDot %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckCharBeforeDot",
+      success);
 
   }
 
@@ -3585,9 +17280,6 @@ bool CBoFileCheckSpaceBeforeOpenCurlyBrace(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -3599,115 +17291,42 @@ bool CBoFileCheckSpaceBeforeOpenCurlyBrace(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckSpaceBeforeOpenCurlyBrace %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
-      // If the line is not a comment
-      if (CBoLineIsComment(line) == false) {
-
-        // Get the length of the line
-        unsigned int length = CBoLineGetLength(line);
-
-        // Declare two variables to manage strings
-        bool flagQuote = false;
-        bool flagDoubleQuote = false;
-
-        // Loop on the char in the line
-        for (
-          unsigned int iChar = 0;
-          iChar < length;
-          ++iChar) {
-
-          if (line->str[iChar] == '\'') {
-
-            if (flagDoubleQuote == false) {
-
-              flagQuote = !flagQuote;
-
-            }
-
-          } else if (line->str[iChar] == '"') {
-
-            if (flagQuote == false) {
-
-              flagDoubleQuote = !flagDoubleQuote;
-
-            }
-
-          }
-
-          // If we are not in a string
-          if (flagQuote == false && flagDoubleQuote == false) {
-
-            // If the char is an opening curly brace and not preceded
-            // by another curly brace or space
-            if (
-              line->str[iChar] == '{' &&
-              iChar > 0 &&
-              line->str[iChar - 1] != ' ' &&
-              line->str[iChar - 1] != '{') {
-
-              // Update the success flag
-              success = false;
-
-              // Create the error
-              CBoError* error =
-                CBoErrorCreate(
-                  that,
-                  line,
-                  iLine + 1,
-                  CBoErrorType_SpaceBeforeOpeningCurlyBrace);
-
-              // Add the error to the file
-              CBoFileAddError(
-                that,
-                error);
-
-              // Skip the end of the line
-              iChar = length;
-
-            }
-
-          }
-
-        }
+      // If the line breaks the rule
+      unsigned int mask = (1u << CBoRuleId_SpaceBeforeOpenCurlyBrace);
+      if ((line->localErrors & mask) != 0) {
 
-      }
+        // Update the success flag
+        success = false;
 
-      ++iLine;
+        // Create the error
+        CBoError* error =
+          CBoErrorCreate(
+            that,
+            line,
+            iLine + 1,
+            CBoErrorType_SpaceBeforeOpeningCurlyBrace);
 
-    } while (GSetIterStep(&iter));
+        // Add the error to the file
+        CBoFileAddError(
+          that,
+          error);
 
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckSpaceBeforeOpenCurlyBrace %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
+      }
 
-      fprintf(
-        cbo->stream,
-        " OK");
+      ++iLine;
 
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckSpaceBeforeOpenCurlyBrace",
+      success);
 
   }
 
@@ -3749,95 +17368,63 @@ bool CBoFileCheckEmptyLineBeforeComment(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 1) {
 
-    // Variable to memorize the previous non comment line
-    CBoLine* prevLine = NULL;
-
-    // Declare an iterator on the lines
-    GSetIterForward iter =
-      GSetIterForwardCreateStatic(&(that->lines));
-
-    // Loop on the lines
-    unsigned int iLine = 0;
-    do {
-
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckEmptyLineBeforeComment %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
+    // Shortcuts to the bitsets
+    const uint64_t* blank = that->lineFlags[CBoLineFlag_blank];
+    const uint64_t* comment = that->lineFlags[CBoLineFlag_comment];
+    const uint64_t* precompilCmd =
+      that->lineFlags[CBoLineFlag_precompilCmd];
+
+    // Declare a mask for the first line, which has no previous line
+    uint64_t maskFirstLine = ~((uint64_t)1);
+
+    // Loop on the words of the bitsets
+    for (
+      unsigned int iWord = 0;
+      iWord < that->nbWord &&
+      CBoFileIsErrorBudgetSpent(that) == false;
+      ++iWord) {
+
+      // A line is in error if it's a comment out of a macro definition
+      // and the previous line exists, is not empty and not a comment
+      uint64_t word =
+        ~CBoBitsetGetPrevWord(
+          blank,
+          iWord) &
+        ~CBoBitsetGetPrevWord(
+          comment,
+          iWord) &
+        comment[iWord] &
+        ~precompilCmd[iWord];
+      if (iWord == 0) {
+
+        word &= maskFirstLine;
 
-      // Get the line
-      CBoLine* line = GSetIterGet(&iter);
+      }
 
-      // If the line is a comment and the previous line is not empty and
-      // not a comment and we are not in a macro definition
-      bool isLinePrecompilCmd =
-        CBoFileIsLinePrecompilCmd(
+      // Add the errors of this word to the file
+      bool noError =
+        CBoFileAddErrorsFromWord(
           that,
-          iLine);
-      if (
-        prevLine != NULL &&
-        CBoLineGetLength(prevLine) != 0 &&
-        CBoLineIsComment(prevLine) == false &&
-        CBoLineIsComment(line) == true &&
-        isLinePrecompilCmd == false) {
+          word,
+          iWord,
+          CBoErrorType_EmptyLineBeforeComment);
+      if (noError == false) {
 
         // Update the success flag
         success = false;
 
-        // Create the error
-        CBoError* error =
-          CBoErrorCreate(
-            that,
-            line,
-            iLine + 1,
-            CBoErrorType_EmptyLineBeforeComment);
-
-        // Add the error to the file
-        CBoFileAddError(
-          that,
-          error);
-
       }
 
-      // Update the previous line
-      prevLine = line;
-
-      // Move to the next line
-      ++iLine;
-
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckEmptyLineBeforeComment %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
     }
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckEmptyLineBeforeComment",
+      success);
 
   }
 
@@ -3879,9 +17466,6 @@ bool CBoFileCheckIndentLevel(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -3893,16 +17477,6 @@ bool CBoFileCheckIndentLevel(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckIndentLevel %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
@@ -3923,6 +17497,14 @@ bool CBoFileCheckIndentLevel(
           that,
           iLine);
 
+      // Check if the rule is suppressed on the line, the function
+      // declarations are still skipped to follow the line
+      bool isSuppressed =
+        CBoFileIsSuppressed(
+          that,
+          iLine,
+          CBoErrorType_IndentLevel);
+
       // If the line is a function declaration
       if (
         CBoLineIsComment(line) == false &&
@@ -3943,8 +17525,8 @@ bool CBoFileCheckIndentLevel(
           // Declare a variable to memorize the position in the line
           unsigned int pos = 0;
 
-          // Loop on the char of the line
-          do {
+          // Loop on the char of the line, if it's not empty
+          if (line->str[0] != '\0') do {
 
             // If it's a opening parenthesis
             if (line->str[pos] == '(') {
@@ -3967,13 +17549,15 @@ bool CBoFileCheckIndentLevel(
 
         } while (
           lvlPar > 0 &&
-          GSetIterStep(&iter));
+          GSetIterStep(&iter) == true &&
+          ++iLine > 0);
 
       // Else, if the line is a comment
       } else if (CBoLineIsComment(line) == true) {
 
         // If the line is not indented as the next line
         if (
+          isSuppressed == false &&
           nextLine != NULL &&
           posHead != CBoLineGetPosHead(nextLine)) {
 
@@ -3998,6 +17582,7 @@ bool CBoFileCheckIndentLevel(
       // Else, the line is not a comment or precompiler command,
       // if the line is not correctly indented and not empty
       } else if (
+        isSuppressed == false &&
         isPrecompilCmd == false &&
         posHead != length &&
         posHead != line->indent) {
@@ -4023,28 +17608,15 @@ bool CBoFileCheckIndentLevel(
       // Move to the next line
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckIndentLevel %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckIndentLevel",
+      success);
 
   }
 
@@ -4086,9 +17658,6 @@ bool CBoFileCheckTabIndent(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -4100,33 +17669,12 @@ bool CBoFileCheckTabIndent(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckTabIndent %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
-      // Get the position of the head of the line
-      unsigned int posHead = CBoLineGetPosHead(line);
-
-      // Search for tab in the indentation
-      char tmp = line->str[posHead];
-      line->str[posHead] = '\0';
-      char* posTab =
-        strchr(
-          line->str,
-          '\t');
-      line->str[posHead] = tmp;
-
-      // If there are tabs in the indentation
-      if (posTab != NULL) {
+      // If the line breaks the rule
+      unsigned int mask = (1u << CBoRuleId_TabIndent);
+      if ((line->localErrors & mask) != 0) {
 
         // Update the success flag
         success = false;
@@ -4149,28 +17697,15 @@ bool CBoFileCheckTabIndent(
       // Move to the next line
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckTabIndent %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckTabIndent",
+      success);
 
   }
 
@@ -4212,117 +17747,67 @@ bool CBoFileCheckEmptyLineBeforeCase(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
-    // Declare an iterator on the lines
-    GSetIterForward iter =
-      GSetIterForwardCreateStatic(&(that->lines));
-
-    // Loop on the lines
-    unsigned int iLine = 0;
-    do {
-
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckEmptyLineBeforeCase %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
-      // Get the line
-      CBoLine* line = GSetIterGet(&iter);
-
-      // Get the next line
-      GSetIterForward iterNext = iter;
-      GSetIterStep(&iterNext);
-      CBoLine* nextLine = GSetIterGet(&iterNext);
-
-      // If there is a next line
-      if (nextLine != NULL) {
-
-        // Get the position of the head of the next line
-        unsigned int posHead = CBoLineGetPosHead(nextLine);
-
-        // Check if the next line starts with 'case ' or 'default:'
-        char *posCase =
-          strstr(
-            nextLine->str + posHead,
-            "case ");
-        if (posCase == NULL) {
-
-          posCase =
-            strstr(
-              nextLine->str + posHead,
-              "default:");
-
-        }
-
-        bool startsWithCase = (posCase == nextLine->str + posHead);
-        bool isPrecompilerCmd =
-          CBoFileIsLinePrecompilCmd(
-            that,
-            iLine);
-
-        // If the next line starts with 'case ' and the current line
-        // is nor a blank line nor a comment nor a precompiled command
-        if (
-          CBoLineIsComment(line) == false &&
-          isPrecompilerCmd == false &&
-          line->str[0] != '\0' &&
-          startsWithCase == true) {
-
-          // Update the success flag
-          success = false;
-
-          // Create the error
-          CBoError* error =
-            CBoErrorCreate(
-              that,
-              nextLine,
-              iLine + 2,
-              CBoErrorType_EmptyLineBeforeCase);
-
-          // Add the error to the file
-          CBoFileAddError(
-            that,
-            error);
-
-        }
+    // Shortcuts to the bitsets
+    const uint64_t* blank = that->lineFlags[CBoLineFlag_blank];
+    const uint64_t* comment = that->lineFlags[CBoLineFlag_comment];
+    const uint64_t* precompilCmd =
+      that->lineFlags[CBoLineFlag_precompilCmd];
+    const uint64_t* caseLabel = that->lineFlags[CBoLineFlag_caseLabel];
+
+    // Declare a mask for the first line, which has no previous line
+    uint64_t maskFirstLine = ~((uint64_t)1);
+
+    // Loop on the words of the bitsets
+    for (
+      unsigned int iWord = 0;
+      iWord < that->nbWord &&
+      CBoFileIsErrorBudgetSpent(that) == false;
+      ++iWord) {
+
+      // A line is in error if it starts with 'case ' or 'default:'
+      // and the previous line exists and is nor a blank line nor a
+      // comment nor a precompiler command
+      uint64_t word =
+        caseLabel[iWord] &
+        ~CBoBitsetGetPrevWord(
+          blank,
+          iWord) &
+        ~CBoBitsetGetPrevWord(
+          comment,
+          iWord) &
+        ~CBoBitsetGetPrevWord(
+          precompilCmd,
+          iWord);
+      if (iWord == 0) {
+
+        word &= maskFirstLine;
 
       }
 
-      // Move to the next line
-      ++iLine;
-
-    } while (GSetIterStep(&iter));
+      // Add the errors of this word to the file
+      bool noError =
+        CBoFileAddErrorsFromWord(
+          that,
+          word,
+          iWord,
+          CBoErrorType_EmptyLineBeforeCase);
+      if (noError == false) {
 
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckEmptyLineBeforeCase %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
+        // Update the success flag
+        success = false;
 
-      fprintf(
-        cbo->stream,
-        " OK");
+      }
 
     }
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckEmptyLineBeforeCase",
+      success);
 
   }
 
@@ -4364,9 +17849,6 @@ bool CBoFileCheckMacroNameAllCapital(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -4378,16 +17860,6 @@ bool CBoFileCheckMacroNameAllCapital(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckMacroNameAllCapital %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
@@ -4402,8 +17874,16 @@ bool CBoFileCheckMacroNameAllCapital(
 
       bool startsWithDefine = (posDefine == line->str + posHead);
 
-      // If the line starts with '#define'
-      if (startsWithDefine == true) {
+      // If the line starts with '#define' and the rule is not suppressed
+      // on the line
+      bool isSuppressed =
+        CBoFileIsSuppressed(
+          that,
+          iLine,
+          CBoErrorType_MacroNameMustBeCapital);
+      if (
+        startsWithDefine == true &&
+        isSuppressed == false) {
 
         // Loop on the macro name
         char* ptrName = posDefine + strlen("#define ");
@@ -4440,28 +17920,15 @@ bool CBoFileCheckMacroNameAllCapital(
       // Move to the next line
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckMacroNameAllCapital %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckMacroNameAllCapital",
+      success);
 
   }
 
@@ -4503,9 +17970,6 @@ bool CBoFileCheckSeveralArgOnOneLine(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -4517,26 +17981,23 @@ bool CBoFileCheckSeveralArgOnOneLine(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CheckSeveralArgOnOneLine %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
-      // If the line is not a comment and not a precompiler command
+      // If the rule is not suppressed on the line, and the line is not
+      // a comment and not a precompiler command
       bool isPrecompilCmd =
         CBoFileIsLinePrecompilCmd(
           that,
           iLine);
-
+      bool isSuppressed =
+        CBoFileIsSuppressed(
+          that,
+          iLine,
+          CBoErrorType_SeveralArgOnOneLine);
       if (
+        isSuppressed == false &&
+        CBoLineGetLength(line) > 0 &&
         CBoLineIsComment(line) == false &&
         isPrecompilCmd == false) {
 
@@ -4696,28 +18157,15 @@ bool CBoFileCheckSeveralArgOnOneLine(
       // Move to the next line
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CheckSeveralArgOnOneLine %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CheckSeveralArgOnOneLine",
+      success);
 
   }
 
@@ -4759,9 +18207,6 @@ bool CBoFileCheckAlignmentArg(
   // Declare a variable to memorize the success
   bool success = true;
 
-  // Create a progress bar
-  ProgBarTxt progBar = ProgBarTxtCreateStatic();
-
   // If the file is not empty
   if (GSetNbElem(&(that->lines)) > 0) {
 
@@ -4773,16 +18218,6 @@ bool CBoFileCheckAlignmentArg(
     unsigned int iLine = 0;
     do {
 
-      // Update and display the ProgBar
-      ProgBarTxtSet(
-        &progBar,
-        (float)iLine / (float)GSetNbElem(&(that->lines)));
-      fprintf(
-        cbo->stream,
-        "CBoFileCheckAlignmentArg %s\r",
-        ProgBarTxtGet(&progBar));
-      fflush(cbo->stream);
-
       // Get the line
       CBoLine* line = GSetIterGet(&iter);
 
@@ -4823,8 +18258,8 @@ bool CBoFileCheckAlignmentArg(
           // Declare a variable to memorize the position in the line
           unsigned int pos = 0;
 
-          // Loop on the char of the line
-          do {
+          // Loop on the char of the line, if it's not empty
+          if (lineArg->str[0] != '\0') do {
 
             // If it's a opening parenthesis
             if (lineArg->str[pos] == '(') {
@@ -4885,8 +18320,8 @@ bool CBoFileCheckAlignmentArg(
           // Declare a variable to memorize the position in the line
           unsigned int pos = 0;
 
-          // Loop on the char of the line
-          do {
+          // Loop on the char of the line, if it's not empty
+          if (lineArg->str[0] != '\0') do {
 
             // If it's a opening parenthesis
             if (lineArg->str[pos] == '(') {
@@ -4919,8 +18354,16 @@ bool CBoFileCheckAlignmentArg(
           } while(lineArg->str[pos] != '\0');
 
           // If the position of the last space is not equal to the
-          // max position in the list of arguments
-          if (posLastSpace != posMaxLastSpace) {
+          // max position in the list of arguments and the rule is not
+          // suppressed on the line
+          bool isSuppressed =
+            CBoFileIsSuppressed(
+              that,
+              iLineArg,
+              CBoErrorType_ArgumentsUnaligned);
+          if (
+            posLastSpace != posMaxLastSpace &&
+            isSuppressed == false) {
 
               // Update the success flag
               success = false;
@@ -4952,28 +18395,15 @@ bool CBoFileCheckAlignmentArg(
       // Move to the next line
       ++iLine;
 
-    } while (GSetIterStep(&iter));
-
-    // Update and display the ProgBar
-    ProgBarTxtSet(
-      &progBar,
-      1.0);
-    fprintf(
-      cbo->stream,
-      "CBoFileCheckAlignmentArg %s",
-      ProgBarTxtGet(&progBar));
-    if (success == true) {
-
-      fprintf(
-        cbo->stream,
-        " OK");
-
-    }
+    } while (
+      GSetIterStep(&iter) == true &&
+      CBoFileIsErrorBudgetSpent(that) == false);
 
-    fprintf(
-      cbo->stream,
-      "\n");
-    fflush(cbo->stream);
+    // Display the result of the rule
+    CBoPrintRuleResult(
+      cbo,
+      "CBoFileCheckAlignmentArg",
+      success);
 
   }
 
@@ -5037,49 +18467,12 @@ bool CBoFileIsLinePrecompilCmd(
 
 #endif
 
-  // Get the line
-  CBoLine* line =
-    GSetGet(
-      &(that->lines),
-      iLine);
-
-  // Get the position of the head of the line
-  unsigned int posHead = CBoLineGetPosHead(line);
-
-  // If the line starts with '#'
-  if (line->str[posHead] == '#') {
-
-    // The line is a precompiler command
-    return true;
-
-  // Else, the line doesn't start with '#'
-  } else {
-
-    // If the previous line is an unterminated precompilation command
-    if (iLine > 0) {
-
-      CBoLine* prevLine =
-        GSetGet(
-          &(that->lines),
-          iLine - 1);
-      unsigned int length = CBoLineGetLength(prevLine);
-      if (
-        length > 0 &&
-        prevLine->str[length - 1] == '\\') {
-
-        return
-          CBoFileIsLinePrecompilCmd(
-            that,
-            iLine - 1);
-
-      }
-
-    }
-
-    // The line is not a precompiler command
-    return false;
+  // Get the index of the word and the mask of the line in the word
+  unsigned int iWord = iLine / CBOFILE_NB_LINE_PER_WORD;
+  uint64_t mask = (uint64_t)1 << (iLine % CBOFILE_NB_LINE_PER_WORD);
 
-  }
+  // Return the bit of the line in the bitset of precompiler commands
+  return ((that->lineFlags[CBoLineFlag_precompilCmd][iWord] & mask) != 0);
 
 }
 
@@ -5399,6 +18792,13 @@ unsigned int CBoLineGetPosLast(
   // Declare a variable to memorize the current position
   int pos = length - 1;
 
+  // If the line is empty, there is nothing to search
+  if (length == 0) {
+
+    return length;
+
+  }
+
   // Flag to escape the strings
   bool flagQuote = false;
   bool flagDoubleQuote = false;
@@ -7,6 +7,21 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <signal.h>
+#include <semaphore.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <sys/uio.h>
 #include "pberr.h"
 #include "gset.h"
 #include "respublish.h"
@@ -14,6 +29,24 @@
 
 // ================= Data structures ===================
 
+// Enum for the formats of the output
+typedef enum CBoFormat {
+
+  // Human readable text
+  CBoFormat_text,
+
+  // One JSON record per error
+  CBoFormat_jsonl,
+
+  // SARIF document, with one result per error
+  CBoFormat_sarif,
+
+  // Binary records, rendered later with --report
+  CBoFormat_binary,
+  CBoFormat_nb
+
+} CBoFormat;
+
 // Structure of the CBo code style checker
 typedef struct CBo {
 
@@ -26,12 +59,148 @@ typedef struct CBo {
   // Set of CBoFile with error
   GSet filesWithError;
 
-  // Stream on which the output is printed
+  // Stream on which the output is printed, NULL while a file is checked
+  // if the output of its check is not displayed
   FILE* stream;
 
+  // Flag to remember if the output is colored, by default only if the
+  // stream is a terminal
+  bool flagColor;
+
   // Flag to remember if we print only the list of files with errors
   bool flagListFileError;
 
+  // Flag to remember if we stop at the first error
+  bool flagFirstError;
+
+  // Maximum number of errors per file, 0 if there is no limit
+  unsigned int nbMaxErrorPerFile;
+
+  // Number of threads used to check the files
+  unsigned int nbThread;
+
+  // Path of the file where the check time of each file is recorded,
+  // NULL if not used
+  const char* timingsPath;
+
+  // Minimum number of lines of a file to check its rules in parallel,
+  // 0 if the rules are never checked in parallel
+  unsigned int nbLineParallelRules;
+
+  // Maximum memory used by the loaded files, in bytes, 0 if there is
+  // no limit
+  size_t maxMemory;
+
+  // Index of the shard of files to check, in [1, nbShard], and number
+  // of shards, 0 if the files are not sharded
+  unsigned int iShard;
+  unsigned int nbShard;
+
+  // Path of the file where the partial result of the shard is saved
+  const char* shardPath;
+
+  // Number of files in the command line, including the ones of the
+  // other shards, and index in the command line of each file of the
+  // shard
+  unsigned int nbPathAllShard;
+  unsigned int* shardIndexes;
+
+  // Flag to remember if the paths are partial results to merge instead
+  // of files to check
+  bool flagMerge;
+
+  // Flag to remember if the paths are binary results to render instead
+  // of files to check
+  bool flagReport;
+
+  // Number of files, files with error and errors of the merged partial
+  // results
+  unsigned int nbMergedFile;
+  unsigned int nbMergedFileWithError;
+  unsigned int nbMergedError;
+
+  // Flag to remember if the merged partial results or the rendered
+  // binary results were incomplete or invalid, in which case their
+  // totals are meaningless
+  bool flagInvalidResult;
+
+  // Path of the Unix socket on which the coordinator distributes the
+  // files to the worker processes, NULL if not used
+  const char* socketPath;
+
+  // Flag to remember if this CBo is a worker process checking the
+  // files distributed by the coordinator, else it's the coordinator
+  bool flagWorker;
+
+  // Percentage of the files checked in sampling mode, 0 if all the
+  // files are checked, and seed of the sampling
+  double samplePercent;
+  unsigned int sampleSeed;
+
+  // Number of strata (directories) of the sampled files, number of
+  // files of each stratum, and stratum of each sampled file
+  unsigned int nbStratum;
+  unsigned int* stratumNbPath;
+  unsigned int* sampleStrata;
+
+  // Flag to remember if each file is checked in its own child process,
+  // and time budget in milliseconds of the check of one file, 0 if
+  // there is no limit
+  bool flagIsolate;
+  unsigned int timeoutMs;
+
+  // Progress reporter of the check of the files, NULL if the progress
+  // is not displayed
+  struct CBoProgress* progress;
+
+  // Format of the output, and flag to remember if a result has already
+  // been written in the SARIF document
+  CBoFormat format;
+  bool flagResultWritten;
+
+  // Paths of the files whose records have been written in the binary
+  // output, in the order of their index in the records, and number of
+  // records written
+  GSetStr binaryPaths;
+  unsigned int nbBinaryRecord;
+
+  // Path of the baseline of the known errors, NULL if not used, flag to
+  // remember if the baseline is updated with the errors of the check
+  // instead of being applied, and hash set of the known errors, NULL if
+  // the baseline is not applied
+  const char* baselinePath;
+  bool flagUpdateBaseline;
+  struct CBoBaseline* baseline;
+
+  // Flag to remember if the errors of the mechanical rules are fixed
+  // in the checked files
+  bool flagFix;
+
+  // Flag to remember if the lines of the checked files are reindented
+  // to their computed indentation level
+  bool flagReindent;
+
+  // Flag to remember if the fixes are displayed as a unified diff
+  // instead of being applied to the checked files
+  bool flagFixDiff;
+
+  // First and last lines, from 1, of the range of lines checked in the
+  // files, 0 if the whole files are checked
+  unsigned int rangeFirstLine;
+  unsigned int rangeLastLine;
+
+  // Memoization table of the results of the line local rules, shared
+  // by all the files
+  uint64_t* lineMemo;
+
+  // Order of check of the rules, calculated once by CBoCheckAllFiles
+  // for all the files, NULL until then
+  unsigned int* ruleOrder;
+
+  // Error state of this CBo, initialised from CBoErr at creation, used
+  // instead of CBoErr so several CBo can check files concurrently
+  PBErr* err;
+
 } CBo;
 
 // ================ Functions declaration ====================
@@ -31,10 +31,12 @@ int main(
     if (success == true) {
 
       // If the user hasn't requested to display only the list of
-      // file(s) with error(s)
+      // file(s) with error(s), nor the diff of the fixes
       if (
         CBoGetNbFiles(cbo) > 0 &&
-        cbo->flagListFileError == false) {
+        cbo->flagListFileError == false &&
+        cbo->flagFixDiff == false &&
+        cbo->format == CBoFormat_text) {
 
         fprintf(
           cbo->stream,
@@ -43,12 +45,18 @@ int main(
 
       }
 
-    // Else, at least one file contained error
+    // Else, at least one file contained error, or the merged or
+    // rendered results were invalid
     } else {
 
       // If the user hasn't requested to display only the list of
-      // file(s) with error(s)
-      if (cbo->flagListFileError == false) {
+      // file(s) with error(s), nor an output for a machine, nor the
+      // diff of the fixes, and the results are valid
+      if (
+        cbo->flagInvalidResult == false &&
+        cbo->flagListFileError == false &&
+        cbo->flagFixDiff == false &&
+        cbo->format == CBoFormat_text) {
 
         fprintf(
           cbo->stream,